@@ -18,6 +18,7 @@
 #include "tools/ContextTools.h"
 #include "tools/LevelTools.h"
 #include "tools/QuestTools.h"
+#include "tools/BenchmarkTools.h"
 
 namespace ai {
 
@@ -89,6 +90,10 @@ void registerBuiltInTools() {
     registry.registerTool<AddQuestObjectiveTool>();
     registry.registerTool<LinkQuestToNPCTool>();
     
+    // Benchmark tools
+    LOG_DEBUG("[AI] Registering Benchmark tools");
+    registry.registerTool<RunPhysicsBenchmarkTool>();
+    
     LOG_INFO("[AI] Registered " + std::to_string(registry.getToolCount()) + " tools");
 }
 
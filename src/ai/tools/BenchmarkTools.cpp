@@ -0,0 +1,103 @@
+/**
+ * @file BenchmarkTools.cpp
+ * @brief Implementation of AI tools for engine benchmarks
+ */
+#include "BenchmarkTools.h"
+#include "engine/physics/NarrowphaseBenchmark.h"
+#include "engine/physics/physx/BroadphaseBenchmark3D.h"
+#include "engine/physics/physx/PhysicsQueryBenchmark3D.h"
+#include "engine/utils/Logger.h"
+#include <algorithm>
+
+namespace ai {
+
+ToolResult RunPhysicsBenchmarkTool::execute(const nlohmann::json& params) {
+    std::string kind = params.value("kind", "queries3d");
+    
+    if (kind == "queries3d") {
+        engine::physics::QueryBenchmarkSettings3D settings;
+        settings.bodyCount = std::max(1, params.value("bodies", settings.bodyCount));
+        settings.queryCount = std::max(1, params.value("queries", settings.queryCount));
+        settings.iterations = std::max(1, params.value("iterations", settings.iterations));
+        
+        LOG_INFO("[AI] Running queries3d benchmark");
+        auto result = engine::physics::runQueryBenchmark3D(settings);
+        
+        nlohmann::json data = {
+            {"bodies", settings.bodyCount},
+            {"queries", settings.queryCount},
+            {"workers", result.workerCount},
+            {"single_raycast_ms", result.singleRaycastMs},
+            {"batch_raycast_ms", result.batchRaycastMs},
+            {"parallel_raycast_ms", result.parallelRaycastMs},
+            {"parallel_raycast_all_ms", result.parallelRaycastAllMs},
+            {"parallel_sweep_ms", result.parallelSweepMs},
+            {"parallel_overlap_ms", result.parallelOverlapMs},
+            {"raycast_hits", result.raycastHits},
+            {"truncated_raycasts_all", result.truncatedRaycastsAll},
+            {"truncated_overlaps", result.truncatedOverlaps}
+        };
+        return ToolResult::ok(result.summary(), data);
+    }
+    
+    if (kind == "narrowphase") {
+        engine::NarrowphaseBenchmarkSettings settings;
+        settings.shapeCount = std::max(1, params.value("bodies", settings.shapeCount));
+        settings.queryCount = std::max(1, params.value("queries", settings.queryCount));
+        settings.iterations = std::max(1, params.value("iterations", settings.iterations));
+        
+        LOG_INFO("[AI] Running narrowphase benchmark");
+        auto result = engine::runNarrowphaseBenchmark(settings);
+        
+        nlohmann::json data = {
+            {"shapes", settings.shapeCount},
+            {"queries", settings.queryCount},
+            {"simd_level", result.simdLevel},
+            {"pair_tests", result.pairTests},
+            {"virtual_ms", result.virtualMs},
+            {"batch_scalar_ms", result.scalarMs},
+            {"batch_simd_ms", result.simdMs},
+            {"virtual_hits", result.virtualHits},
+            {"batch_hits", result.batchHits}
+        };
+        return ToolResult::ok(result.summary(), data);
+    }
+    
+    if (kind == "broadphase3d") {
+        engine::physics::BroadphaseBenchmarkSettings3D settings;
+        settings.bodyCount = std::max(1, params.value("bodies", settings.bodyCount));
+        settings.queryCount = std::max(1, params.value("queries", settings.queryCount));
+        settings.steps = std::max(1, params.value("steps", settings.steps));
+        settings.fullSweep = params.value("full", settings.fullSweep);
+        
+        LOG_INFO("[AI] Running broadphase3d benchmark");
+        auto result = engine::physics::runBroadphaseBenchmark3D(settings);
+        
+        nlohmann::json runs = nlohmann::json::array();
+        for (const auto& run : result.runs) {
+            runs.push_back({
+                {"config", run.label()},
+                {"ok", run.ok},
+                {"step_ms", run.stepMs},
+                {"query_ms", run.queryMs},
+                {"raycast_hits", run.raycastHits}
+            });
+        }
+        
+        nlohmann::json data = {
+            {"bodies", settings.bodyCount},
+            {"queries", settings.queryCount},
+            {"steps", settings.steps},
+            {"full", settings.fullSweep},
+            {"runs", runs},
+            {"failed_runs", result.failedRuns},
+            {"fastest_step", result.fastestStep >= 0 ? result.runs[result.fastestStep].label() : ""},
+            {"fastest_total", result.fastestTotal >= 0 ? result.runs[result.fastestTotal].label() : ""}
+        };
+        return ToolResult::ok(result.summary(), data);
+    }
+    
+    return ToolResult::error("Unknown benchmark kind: " + kind);
+}
+
+} // namespace ai
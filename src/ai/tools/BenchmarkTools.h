@@ -0,0 +1,63 @@
+/**
+ * @file BenchmarkTools.h
+ * @brief AI tools for running engine benchmarks from the editor
+ */
+#pragma once
+
+#include "ai/core/IEditorTool.h"
+
+namespace ai {
+
+/**
+ * @class RunPhysicsBenchmarkTool
+ * @brief Run a headless physics benchmark and report timings
+ */
+class RunPhysicsBenchmarkTool : public IEditorTool {
+public:
+    const char* getName() const override { return "physics_benchmark"; }
+    const char* getDescription() const override { 
+        return "Run a headless physics benchmark in its own world and report timings. "
+               "kind=queries3d compares single PhysX raycasts with batched ray/sweep/overlap queries, "
+               "kind=narrowphase compares CollisionShape::overlaps with the SIMD ShapeBatch, "
+               "kind=broadphase3d steps the same PhysX scene under every broadphase/aggregate setting (full=true adds the pruning structures)."; 
+    }
+    const char* getCategory() const override { return "system"; }
+    
+    nlohmann::json getParameterSchema() const override {
+        return {
+            {"type", "object"},
+            {"properties", {
+                {"kind", {
+                    {"type", "string"},
+                    {"enum", {"queries3d", "narrowphase", "broadphase3d"}},
+                    {"description", "Benchmark to run (default: queries3d)"}
+                }},
+                {"bodies", {
+                    {"type", "integer"},
+                    {"description", "Number of bodies (queries3d default: 2000, broadphase3d default: 1000) or stored shapes (narrowphase, default: 4096)"}
+                }},
+                {"queries", {
+                    {"type", "integer"},
+                    {"description", "Number of queries per batch (queries3d default: 10000, narrowphase default: 512, broadphase3d default: 1000 per step)"}
+                }},
+                {"steps", {
+                    {"type", "integer"},
+                    {"description", "Simulated frames per combination (broadphase3d, default: 60)"}
+                }},
+                {"full", {
+                    {"type", "boolean"},
+                    {"description", "Also sweep the static/dynamic pruning structures, 32 runs instead of 8 (broadphase3d, default: false)"}
+                }},
+                {"iterations", {
+                    {"type", "integer"},
+                    {"description", "Runs per measurement, best time is reported (default: 5)"}
+                }}
+            }},
+            {"required", nlohmann::json::array()}
+        };
+    }
+    
+    ToolResult execute(const nlohmann::json& params) override;
+};
+
+} // namespace ai
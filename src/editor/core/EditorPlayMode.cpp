@@ -8,15 +8,46 @@
 #include "engine/core/ActorObjectExtended.h"
 #include "engine/components/RigidBody3DComponent.h"
 #include "engine/components/RigidBody2DComponent.h"
+#include "engine/components/Collider2DComponent.h"
 #include "engine/actors/StaticMeshActor.h"
 #include "engine/actors/PlayerStartActor.h"
 #include "engine/actors/Character3DActor.h"
 #include "engine/utils/Logger.h"
 #include <PxPhysicsAPI.h>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <unordered_set>
 
 namespace editor {
 
+namespace {
+
+/** @brief FNV-1a accumulator for the play-mode physics signature */
+class SignatureHasher {
+public:
+    template<typename T>
+    void add(const T& value) {
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        for (unsigned char b : bytes) {
+            m_hash ^= b;
+            m_hash *= 1099511628211ULL;
+        }
+    }
+    
+    void add(const glm::vec2& v) { add(v.x); add(v.y); }
+    void add(const glm::vec3& v) { add(v.x); add(v.y); add(v.z); }
+    
+    uint64_t value() const { return m_hash; }
+    
+private:
+    uint64_t m_hash = 14695981039346656037ULL;
+};
+
+} // namespace
+
 EditorPlayMode::EditorPlayMode() = default;
 
 EditorPlayMode::~EditorPlayMode() {
@@ -26,6 +57,12 @@ EditorPlayMode::~EditorPlayMode() {
 void EditorPlayMode::initialize() {
     LOG_INFO("[EditorPlayMode] Initializing...");
     
+    // RETRO_PHYSX_NO_CUDA=1 skips the CUDA probe on machines without a GPU
+    engine::physics::WorldSettings3D settings3D;
+    const char* noCuda = std::getenv("RETRO_PHYSX_NO_CUDA");
+    settings3D.probeCuda = !(noCuda && noCuda[0] == '1');
+    m_physicsManager.setSettings3D(settings3D);
+    
     m_physicsManager.initializeBoth();
     
     if (m_physicsManager.isGPUAccelerationAvailable()) {
@@ -41,9 +78,20 @@ void EditorPlayMode::shutdown() {
     if (m_state != PlayState::Stopped) {
         stop();
     }
+    cleanupPhysicsBodies();
     m_physicsManager.shutdown();
 }
 
+void EditorPlayMode::setActiveScene(engine::Scene* scene) {
+    if (scene == m_activeScene) return;
+    
+    // Bodies belong to the old scene's components - drop them while it's still alive
+    if (m_state == PlayState::Stopped) {
+        cleanupPhysicsBodies();
+    }
+    m_activeScene = scene;
+}
+
 void EditorPlayMode::play() {
     if (m_state == PlayState::Playing) return;
     
@@ -57,8 +105,8 @@ void EditorPlayMode::play() {
         LOG_INFO("[EditorPlayMode] Physics 3D: " + std::string(m_physicsManager.is3DInitialized() ? "YES" : "NO"));
         LOG_INFO("[EditorPlayMode] GPU Acceleration: " + std::string(m_physicsManager.isGPUAccelerationAvailable() ? "YES" : "NO"));
         
+        preparePhysics();
         saveSceneState();
-        initializePhysicsBodies();
         spawnPlayerAtStart();
         
         m_playTime = 0.0f;
@@ -77,6 +125,7 @@ void EditorPlayMode::pause() {
     if (m_state != PlayState::Playing) return;
     
     LOG_INFO("[EditorPlayMode] Pausing play mode...");
+    m_physicsManager.endStep3D();
     m_state = PlayState::Paused;
     if (onStateChanged) onStateChanged(m_state);
 }
@@ -86,6 +135,9 @@ void EditorPlayMode::stop() {
     
     LOG_INFO("[EditorPlayMode] Stopping play mode...");
     
+    // Let the in-flight 3D step finish before bodies are destroyed
+    m_physicsManager.endStep3D();
+    
     // Cleanup player
     if (m_player) {
         m_player->shutdownController();
@@ -93,7 +145,7 @@ void EditorPlayMode::stop() {
         LOG_INFO("[EditorPlayMode] Player destroyed");
     }
     
-    cleanupPhysicsBodies();
+    restorePhysicsSnapshot();
     restoreSceneState();
     
     m_state = PlayState::Stopped;
@@ -117,7 +169,9 @@ void EditorPlayMode::update(float deltaTime) {
     float scaledDt = deltaTime * m_timeScale;
     scaledDt = std::min(scaledDt, m_maxDeltaTime);
     
-    m_physicsManager.step(scaledDt);
+    // Collect the 3D step started last frame before touching the scene
+    m_physicsManager.endStep3D();
+    m_physicsManager.step2D(scaledDt);
     
     // Update player
     updatePlayer(scaledDt);
@@ -134,53 +188,39 @@ void EditorPlayMode::update(float deltaTime) {
         }
     }
     
-    if (m_activeScene) {
-        for (const auto& actor : m_activeScene->getActors()) {
-            // Use StaticMeshActor's syncFromPhysics for correct coordinate mapping
-            if (auto* meshActor = dynamic_cast<engine::StaticMeshActor*>(actor.get())) {
-                if (meshActor->isPhysicsEnabled()) {
-                    meshActor->syncFromPhysics();
-                    
-                    // Log position every 60 frames
-                    if (m_frameCount % 60 == 0) {
-                        glm::vec3 pos = meshActor->getPosition3D();
-                        LOG_DEBUG("[EditorPlayMode] Actor '" + actor->getName() + 
-                                  "' pos: (" + std::to_string(pos.x) + ", " + 
-                                  std::to_string(pos.y) + ", " + std::to_string(pos.z) + ")");
-                    }
-                }
-            }
-            else if (auto* rb3d = actor->getComponent<engine::RigidBody3DComponent>()) {
-                if (rb3d->isInitialized()) {
-                    glm::vec3 pos = rb3d->getPosition();
-                    
-                    // Log position every 60 frames
-                    if (m_frameCount % 60 == 0) {
-                        LOG_DEBUG("[EditorPlayMode] Actor '" + actor->getName() + 
-                                  "' pos: (" + std::to_string(pos.x) + ", " + 
-                                  std::to_string(pos.y) + ", " + std::to_string(pos.z) + ")");
-                    }
-                    
-                    actor->setPosition(pos.x * 100.0f, pos.z * 100.0f);
-                    actor->setZ(pos.y * 100.0f);
-                }
-            }
-        }
+    // Moved bodies already wrote their pose back in endStep3D() (active actors)
+    if (m_activeScene && m_frameCount % 60 == 0) {
+        m_activeScene->view<engine::RigidBody3DComponent>().each(
+            [](engine::ActorObjectExtended& actor, engine::RigidBody3DComponent& rb3d) {
+                if (!rb3d.isInitialized()) return;
+                glm::vec3 pos = rb3d.getPosition();
+                LOG_DEBUG("[EditorPlayMode] Actor '" + actor.getName() + 
+                          "' pos: (" + std::to_string(pos.x) + ", " + 
+                          std::to_string(pos.y) + ", " + std::to_string(pos.z) + ")");
+            });
     }
     
+    // Next 3D step runs on the dispatcher threads while the editor renders
+    m_physicsManager.beginStep3D(scaledDt);
+    
     m_playTime += scaledDt;
     m_frameCount++;
 }
 
 void EditorPlayMode::saveSceneState() {
-    if (!m_activeScene) return;
-    
     m_sceneStateBackup.clear();
+    if (!m_activeScene) return;
     
     for (const auto& actor : m_activeScene->getActors()) {
-        m_sceneStateBackup += actor->getName() + ":" + 
-                              std::to_string(actor->getX()) + "," + 
-                              std::to_string(actor->getY()) + ";";
+        ActorState state;
+        state.actor = actor.get();
+        state.x = actor->getX();
+        state.y = actor->getY();
+        state.z = actor->getZ();
+        state.hasBody3D = actor->getComponent<engine::RigidBody3DComponent>() != nullptr;
+        state.hasBody2D = actor->getComponent<engine::RigidBody2DComponent>() != nullptr;
+        state.physicsSignature = computePhysicsSignature(*actor);
+        m_sceneStateBackup.push_back(state);
     }
     
     m_hasBackup = true;
@@ -190,24 +230,148 @@ void EditorPlayMode::saveSceneState() {
 void EditorPlayMode::restoreSceneState() {
     if (!m_hasBackup || !m_activeScene) return;
     
-    size_t pos = 0;
+    // Actors destroyed during play are skipped
+    std::unordered_set<engine::ActorObjectExtended*> alive;
     for (const auto& actor : m_activeScene->getActors()) {
-        size_t colonPos = m_sceneStateBackup.find(':', pos);
-        size_t commaPos = m_sceneStateBackup.find(',', colonPos);
-        size_t semiPos = m_sceneStateBackup.find(';', commaPos);
+        alive.insert(actor.get());
+    }
+    
+    for (const auto& state : m_sceneStateBackup) {
+        if (!alive.count(state.actor)) continue;
         
-        if (colonPos != std::string::npos && commaPos != std::string::npos && semiPos != std::string::npos) {
-            float x = std::stof(m_sceneStateBackup.substr(colonPos + 1, commaPos - colonPos - 1));
-            float y = std::stof(m_sceneStateBackup.substr(commaPos + 1, semiPos - commaPos - 1));
-            actor->setPosition(x, y);
-            pos = semiPos + 1;
-        }
+        state.actor->setPosition(state.x, state.y);
+        state.actor->setZ(state.z);
     }
     
+    // The backup stays around so the next play() can tell if the scene was edited
     m_hasBackup = false;
     LOG_DEBUG("[EditorPlayMode] Scene state restored");
 }
 
+bool EditorPlayMode::canReusePhysics() const {
+    if (!m_physicsPrepared || m_preparedScene != m_activeScene) return false;
+    if (!m_activeScene) return true;
+    
+    // Same actors, unmoved and with the same bodies as when play last started
+    const auto& actors = m_activeScene->getActors();
+    if (actors.size() != m_sceneStateBackup.size()) return false;
+    
+    for (size_t i = 0; i < actors.size(); i++) {
+        const ActorState& state = m_sceneStateBackup[i];
+        auto* actor = actors[i].get();
+        
+        if (actor != state.actor) return false;
+        if (actor->getX() != state.x || actor->getY() != state.y || actor->getZ() != state.z) return false;
+        if ((actor->getComponent<engine::RigidBody3DComponent>() != nullptr) != state.hasBody3D) return false;
+        if ((actor->getComponent<engine::RigidBody2DComponent>() != nullptr) != state.hasBody2D) return false;
+        if (computePhysicsSignature(*actor) != state.physicsSignature) return false;
+    }
+    return true;
+}
+
+uint64_t EditorPlayMode::computePhysicsSignature(engine::ActorObjectExtended& actor) {
+    // Everything initializePhysicsBodies() reads when it creates the bodies
+    SignatureHasher hasher;
+    hasher.add(actor.getRotation());
+    hasher.add(actor.getScale().x);
+    hasher.add(actor.getScale().y);
+    
+    if (auto* meshActor = dynamic_cast<engine::StaticMeshActor*>(&actor)) {
+        hasher.add(meshActor->isPhysicsEnabled());
+        hasher.add(meshActor->getBodyType());
+        hasher.add(meshActor->getMass());
+        hasher.add(meshActor->usesGravity());
+        hasher.add(meshActor->getPosition3D());
+        hasher.add(meshActor->getRotation3D());
+        hasher.add(meshActor->getMeshScale());
+    }
+    
+    if (auto* rb3d = actor.getComponent<engine::RigidBody3DComponent>()) {
+        hasher.add(rb3d->getBodyType());
+        hasher.add(rb3d->getShapeType());
+        hasher.add(rb3d->getBoxExtents());
+        hasher.add(rb3d->getSphereRadius());
+        hasher.add(rb3d->getCapsuleRadius());
+        hasher.add(rb3d->getCapsuleHalfHeight());
+        hasher.add(rb3d->getMeshScale());
+        const auto& mesh = rb3d->getCollisionMesh();
+        hasher.add(mesh ? mesh->getContentHash() : 0ULL);
+        hasher.add(rb3d->getMass());
+        hasher.add(rb3d->usesGravity());
+        hasher.add(rb3d->getLinearDamping());
+        hasher.add(rb3d->getAngularDamping());
+    }
+    
+    if (auto* rb2d = actor.getComponent<engine::RigidBody2DComponent>()) {
+        hasher.add(rb2d->getBodyType());
+        hasher.add(rb2d->getGravityScale());
+        hasher.add(rb2d->isFixedRotation());
+        hasher.add(rb2d->getLinearDamping());
+    }
+    
+    if (auto* collider = actor.getComponent<engine::Collider2DComponent>()) {
+        hasher.add(collider->getShapeType());
+        hasher.add(collider->getSize());
+        hasher.add(collider->getOffset());
+        hasher.add(collider->getDensity());
+        hasher.add(collider->getFriction());
+        hasher.add(collider->getRestitution());
+        hasher.add(collider->isTrigger());
+        hasher.add(collider->getCollisionLayer());
+        hasher.add(collider->getCollisionMask());
+    }
+    
+    return hasher.value();
+}
+
+void EditorPlayMode::preparePhysics() {
+    auto start = std::chrono::steady_clock::now();
+    bool reused = canReusePhysics();
+    
+    if (!reused) {
+        cleanupPhysicsBodies();
+        initializePhysicsBodies();
+        m_preparedScene = m_activeScene;
+        m_physicsPrepared = true;
+    }
+    
+    if (auto* world3D = m_physicsManager.getWorld3D()) {
+        world3D->captureSnapshot(m_snapshot3D);
+    }
+    if (auto* world2D = m_physicsManager.getWorld2D()) {
+        world2D->captureSnapshot(m_snapshot2D);
+    }
+    
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    LOG_INFO("[EditorPlayMode] Physics " + std::string(reused ? "reused" : "built") + " in " +
+             std::to_string(elapsed.count()) + " ms (3D=" + std::to_string(m_snapshot3D.size()) +
+             ", 2D=" + std::to_string(m_snapshot2D.size()) + " bodies)");
+}
+
+void EditorPlayMode::restorePhysicsSnapshot() {
+    if (!m_physicsPrepared) return;
+    
+    if (auto* world3D = m_physicsManager.getWorld3D()) {
+        world3D->restoreSnapshot(m_snapshot3D);
+    }
+    if (auto* world2D = m_physicsManager.getWorld2D()) {
+        world2D->restoreSnapshot(m_snapshot2D);
+    }
+    
+    // Mesh actors keep their own 3D transform - pull it back from the restored bodies
+    if (m_preparedScene) {
+        for (const auto& actor : m_preparedScene->getActors()) {
+            if (auto* meshActor = dynamic_cast<engine::StaticMeshActor*>(actor.get())) {
+                if (meshActor->isPhysicsEnabled()) {
+                    meshActor->syncFromPhysics();
+                }
+            }
+        }
+    }
+    
+    LOG_DEBUG("[EditorPlayMode] Physics snapshot restored");
+}
+
 void EditorPlayMode::initializePhysicsBodies() {
     if (!m_activeScene) {
         LOG_WARNING("[EditorPlayMode] No active scene - creating test physics actor");
@@ -262,6 +426,9 @@ void EditorPlayMode::initializePhysicsBodies() {
             LOG_DEBUG("[EditorPlayMode]   -> Has RigidBody2DComponent");
             if (!rb2d->isInitialized() && world2D) {
                 rb2d->initializeBody(world2D);
+                if (auto* collider = actor->getComponent<engine::Collider2DComponent>()) {
+                    collider->initializeShape();
+                }
                 bodyCount2D++;
                 LOG_INFO("[EditorPlayMode]   -> Initialized 2D body for: " + actor->getName());
             }
@@ -317,18 +484,34 @@ void EditorPlayMode::createTestPhysicsActor() {
 }
 
 void EditorPlayMode::cleanupPhysicsBodies() {
-    // Cleanup ground plane
-    if (m_groundPlane && m_physicsManager.getWorld3D()) {
-        m_physicsManager.getWorld3D()->destroyBody(static_cast<physx::PxRigidActor*>(m_groundPlane));
-        m_groundPlane = nullptr;
+    m_snapshot3D.clear();
+    m_snapshot2D.clear();
+    m_physicsPrepared = false;
+    
+    // Cleanup ground plane and test body
+    if (auto* world3D = m_physicsManager.getWorld3D()) {
+        if (m_groundPlane) {
+            world3D->destroyBody(static_cast<physx::PxRigidActor*>(m_groundPlane));
+        }
+        if (m_testBody) {
+            world3D->destroyBody(static_cast<physx::PxRigidActor*>(m_testBody));
+        }
     }
+    m_groundPlane = nullptr;
+    m_testBody = nullptr;
     
-    if (!m_activeScene) return;
+    engine::Scene* scene = m_preparedScene;
+    m_preparedScene = nullptr;
+    if (!scene) return;
     
-    for (const auto& actor : m_activeScene->getActors()) {
+    for (const auto& actor : scene->getActors()) {
         if (auto* rb3d = actor->getComponent<engine::RigidBody3DComponent>()) {
             rb3d->shutdown();
         }
+        // Shape before body, so the collider doesn't keep a stale shape id
+        if (auto* collider = actor->getComponent<engine::Collider2DComponent>()) {
+            collider->shutdown();
+        }
         if (auto* rb2d = actor->getComponent<engine::RigidBody2DComponent>()) {
             rb2d->shutdown();
         }
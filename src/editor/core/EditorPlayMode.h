@@ -10,11 +10,14 @@
 #include "engine/physics/PhysicsManager.h"
 #include <memory>
 #include <functional>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace engine {
     class World;
     class Scene;
+    class ActorObjectExtended;
     class Player3DActor;
     class PlayerStartActor;
 }
@@ -37,6 +40,13 @@ enum class PlayState {
  *   playMode.play();   // Start simulation
  *   playMode.pause();  // Pause simulation
  *   playMode.stop();   // Stop and restore scene
+ * 
+ * Physics bodies for the active scene are built on the first play() and
+ * kept afterwards. play() snapshots the 2D/3D worlds and stop() restores
+ * the snapshot, so a play/stop loop doesn't recreate bodies. The bodies
+ * are rebuilt when the scene changes, when an actor is added, removed,
+ * moved or has its body/collider settings edited while stopped, or after
+ * invalidatePhysics().
  */
 class EditorPlayMode {
 public:
@@ -51,7 +61,11 @@ public:
     void shutdown();
     
     void setWorld(engine::World* world) { m_world = world; }
-    void setActiveScene(engine::Scene* scene) { m_activeScene = scene; }
+    void setActiveScene(engine::Scene* scene);
+    
+    /** @brief Rebuild physics bodies on the next play() (e.g. after editing shapes) */
+    void invalidatePhysics() { m_physicsPrepared = false; }
+    bool isPhysicsPrepared() const { return m_physicsPrepared; }
     
     // ========================================================================
     // PLAY CONTROLS
@@ -120,8 +134,22 @@ public:
     void handleMouseLook(float deltaX, float deltaY);
     
 private:
+    struct ActorState {
+        engine::ActorObjectExtended* actor = nullptr;
+        float x = 0.0f;
+        float y = 0.0f;
+        float z = 0.0f;
+        bool hasBody3D = false;
+        bool hasBody2D = false;
+        uint64_t physicsSignature = 0;  // Body, collider and transform settings
+    };
+    
     void saveSceneState();
     void restoreSceneState();
+    bool canReusePhysics() const;
+    static uint64_t computePhysicsSignature(engine::ActorObjectExtended& actor);
+    void preparePhysics();
+    void restorePhysicsSnapshot();
     void initializePhysicsBodies();
     void cleanupPhysicsBodies();
     void createTestPhysicsActor();
@@ -143,10 +171,16 @@ private:
     float m_playTime = 0.0f;
     int m_frameCount = 0;
     
-    // Scene state backup (for restoring after stop)
-    std::string m_sceneStateBackup;
+    // Scene state backup (for restoring after stop, kept to detect edits)
+    std::vector<ActorState> m_sceneStateBackup;
     bool m_hasBackup = false;
     
+    // Prepared physics, reused across play sessions
+    bool m_physicsPrepared = false;
+    engine::Scene* m_preparedScene = nullptr;
+    engine::physics::WorldSnapshot3D m_snapshot3D;
+    engine::physics::WorldSnapshot2D m_snapshot2D;
+    
     // Test physics body (for demonstration)
     void* m_testBody = nullptr;
     
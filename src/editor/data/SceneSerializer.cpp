@@ -98,7 +98,7 @@ void SceneSerializer::syncFromEngine(engine::Scene* scene) {
         }
         
         // Check player spawn
-        if (actorName == "PlayerSpawn" || actorName == "Spawn") {
+        if (actor->getRole() == engine::ActorRole::PlayerSpawn || actorName == "Spawn") {
             sceneData->playerSpawnX = static_cast<int>(pos.x);
             sceneData->playerSpawnY = static_cast<int>(pos.y);
         }
@@ -137,7 +137,7 @@ void EditorWorldManager::createWorldFromWorldData(Game* game) {
                 
                 // Load background
                 if (!roomData.background.empty()) {
-                    auto* bgActor = scene->findActor("Background");
+                    auto* bgActor = scene->findActor(engine::ActorRole::Background);
                     if (bgActor) {
                         auto* spriteComp = bgActor->getComponent<engine::SpriteComponent>();
                         if (spriteComp) {
@@ -376,7 +376,7 @@ void EditorWorldManager::syncActorsFromContainer(engine::WorldContainer* contain
     
     for (const auto& actor : container->getActors()) {
         // Skip Background actors - they're handled separately
-        if (actor->getName() == "Background") continue;
+        if (actor->getRole() == engine::ActorRole::Background) continue;
         
         editor::ActorData data;
         data.id = actor->getName();  // Use name as ID for now
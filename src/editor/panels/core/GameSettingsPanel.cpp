@@ -94,6 +94,15 @@ void GameSettingsPanel::renderPhysicsSection() {
         settings.setRunSpeed(runSpeed);
     }
     
+    // Solver threads
+    int workers = settings.getPhysicsWorkerCount();
+    if (ImGui::SliderInt("Physics Workers", &workers, 0, 16, workers == 0 ? "Auto" : "%d")) {
+        settings.setPhysicsWorkerCount(workers);
+    }
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Threads for the Box2D solver (0 = one per CPU core)\nApplied when a scene enables physics");
+    }
+    
     ImGui::Spacing();
     
     // Debug draw toggle
@@ -71,7 +71,7 @@ void WorldController::loadRoomsAsScenes(SDL_Renderer* renderer) {
 void WorldController::setupBackgroundTexture(engine::Scene* scene, const RoomData& roomData, SDL_Renderer* renderer) {
     if (roomData.background.empty()) return;
     
-    auto* bgActor = scene->findActor("Background");
+    auto* bgActor = scene->findActor(engine::ActorRole::Background);
     if (!bgActor) return;
     
     auto* spriteComp = bgActor->getComponent<engine::SpriteComponent>();
@@ -88,7 +88,7 @@ void ViewportActorRenderer::renderActorSprite(ImDrawList* drawList, engine::Acto
     
     if (texID && w > 0 && h > 0) {
         // Special handling for background actors
-        if (actor->getName() == "Background" && scene) {
+        if (actor->getRole() == engine::ActorRole::Background && scene) {
             const auto& sceneGrid = scene->getGridPosition();
             float roomWidth = sceneGrid.pixelWidth * zoom;
             float roomHeight = sceneGrid.pixelHeight * zoom;
@@ -123,7 +123,7 @@ void ViewportActorRenderer::renderActorPlaceholder(ImDrawList* drawList, engine:
         drawList->AddText(ImVec2(worldX - 20, worldY + 30 * zoom), 
                          IM_COL32(255, 255, 255, 255), "Player");
     }
-    else if (name == "PlayerSpawn") {
+    else if (actor->getRole() == engine::ActorRole::PlayerSpawn) {
         color = IM_COL32(255, 0, 255, 255);
         drawList->AddCircleFilled(ImVec2(worldX, worldY), 8.0f * zoom, color);
         drawList->AddText(ImVec2(worldX + 10, worldY - 8), color, "Spawn");
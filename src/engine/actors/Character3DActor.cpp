@@ -124,8 +124,8 @@ glm::vec3 Character3DActor::getRightDirection() const {
 void Character3DActor::update(float deltaTime) {
     ActorObjectExtended::update(deltaTime);
     
-    // Sync position from controller to actor
-    if (m_controller && m_controller->isInitialized()) {
+    // Sync position from controller to actor, only when it actually moved
+    if (m_controller && m_controller->isInitialized() && m_controller->consumeMoved()) {
         glm::vec3 pos = m_controller->getPosition();
         setPosition(pos.x * 100.0f, pos.z * 100.0f);
         setZ((pos.y - 0.9f) * 100.0f);
@@ -50,6 +50,10 @@ const std::string& NPC::getName() const {
     return empty;
 }
 
+engine::Name NPC::getNameId() const {
+    return m_actor ? m_actor->getNameId() : engine::Name();
+}
+
 void NPC::interact() {
     if (m_actor) {
         m_actor->interact();
@@ -36,6 +36,7 @@ public:
     
     /** @brief Hämta namn */
     const std::string& getName() const;
+    engine::Name getNameId() const;
     
     /** @brief Interagera med NPC */
     void interact();
@@ -20,11 +20,7 @@ StaticMeshActor::StaticMeshActor(const std::string& name)
 
 void StaticMeshActor::update(float deltaTime) {
     ActorObjectExtended::update(deltaTime);
-    
-    // Sync position from physics if enabled
-    if (m_physicsEnabled && m_rigidBody && m_rigidBody->isInitialized()) {
-        syncFromPhysics();
-    }
+    // Physics pose arrives through applyPhysicsPose() when the body moved
 }
 
 void StaticMeshActor::render(SDL_Renderer* renderer) {
@@ -139,6 +135,9 @@ void StaticMeshActor::createPhysicsBody() {
     m_rigidBody->setBodyType(static_cast<RigidBody3DComponent::BodyType>(m_bodyType));
     m_rigidBody->setMass(m_mass);
     m_rigidBody->setUseGravity(m_useGravity);
+    m_rigidBody->setOnMoved([this](const glm::vec3& position, const glm::vec3& rotation) {
+        applyPhysicsPose(position, rotation);
+    });
     
     // Set shape based on mesh
     if (m_meshComponent) {
@@ -155,6 +154,18 @@ void StaticMeshActor::createPhysicsBody() {
                     m_meshComponent->getScale().y * 0.5f
                 );
                 break;
+            case PrimitiveMeshType::Custom:
+                if (m_meshComponent->hasCollisionMesh()) {
+                    m_rigidBody->setShapeType(m_bodyType == physics::BodyType::Dynamic
+                        ? RigidBody3DComponent::ShapeType::ConvexMesh
+                        : RigidBody3DComponent::ShapeType::TriangleMesh);
+                    m_rigidBody->setCollisionMesh(m_meshComponent->getCollisionMesh(),
+                                                  m_meshComponent->getScale());
+                    break;
+                }
+                m_rigidBody->setShapeType(RigidBody3DComponent::ShapeType::Box);
+                m_rigidBody->setBoxExtents(m_meshComponent->getHalfExtents());
+                break;
             default:
                 m_rigidBody->setShapeType(RigidBody3DComponent::ShapeType::Box);
                 m_rigidBody->setBoxExtents(m_meshComponent->getHalfExtents());
@@ -183,8 +194,12 @@ void StaticMeshActor::destroyPhysicsBody() {
 void StaticMeshActor::syncFromPhysics() {
     if (!m_rigidBody || !m_rigidBody->isInitialized()) return;
     
-    m_position3D = m_rigidBody->getPosition();
-    m_rotation3D = m_rigidBody->getRotation();
+    applyPhysicsPose(m_rigidBody->getPosition(), m_rigidBody->getRotation());
+}
+
+void StaticMeshActor::applyPhysicsPose(const glm::vec3& position, const glm::vec3& rotation) {
+    m_position3D = position;
+    m_rotation3D = rotation;
     
     // Sync to 2D/viewport coordinates:
     // Physics X → 2D X (scaled to pixels)
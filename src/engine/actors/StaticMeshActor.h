@@ -80,10 +80,11 @@ public:
     void setRotation3D(const glm::vec3& rot);
     glm::vec3 getRotation3D() const { return m_rotation3D; }
     
-    // Physics sync (called during play mode)
+    // Physics sync - automatic for moved bodies, call after teleporting/restoring bodies
     void syncFromPhysics();
     
 private:
+    void applyPhysicsPose(const glm::vec3& position, const glm::vec3& rotation);
     void createPhysicsBody();
     void destroyPhysicsBody();
     
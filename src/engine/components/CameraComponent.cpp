@@ -11,12 +11,14 @@ namespace engine {
 CameraComponent::CameraComponent(const std::string& name)
     : SceneComponent(name)
 {
+    // Follow the target after it has moved this frame
+    setTickGroup(TickGroup::PostUpdate);
 }
 
 void CameraComponent::update(float deltaTime) {
     if (!m_followTarget || !m_owner) return;
     
-    Vec2 targetPos = m_followTarget->getPosition();
+    Vec2 targetPos = m_followTarget->getGlobalPosition();
     Vec2 currentPos = m_owner->getPosition();
     
     // Smooth follow
@@ -38,7 +40,7 @@ void CameraComponent::update(float deltaTime) {
 Vec2 CameraComponent::worldToScreen(Vec2 worldPos) const {
     if (!m_owner) return worldPos;
     
-    Vec2 camPos = m_owner->getPosition();
+    Vec2 camPos = getWorldPosition();
     Vec2 offset = (worldPos - camPos) * m_zoom;
     
     return Vec2(
@@ -50,7 +52,7 @@ Vec2 CameraComponent::worldToScreen(Vec2 worldPos) const {
 Vec2 CameraComponent::screenToWorld(Vec2 screenPos) const {
     if (!m_owner) return screenPos;
     
-    Vec2 camPos = m_owner->getPosition();
+    Vec2 camPos = getWorldPosition();
     Vec2 centered = Vec2(
         screenPos.x - m_viewportWidth * 0.5f,
         screenPos.y - m_viewportHeight * 0.5f
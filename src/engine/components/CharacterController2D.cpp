@@ -4,7 +4,9 @@
  */
 #include "CharacterController2D.h"
 #include "RigidBody2DComponent.h"
+#include "engine/physics/box2d/PhysicsWorld2D.h"
 #include "engine/core/ActorObjectExtended.h"
+#include "engine/nodes/TileMapLayer.h"
 #include <cmath>
 #include <algorithm>
 
@@ -19,6 +21,10 @@ CharacterController2D::CharacterController2D(const std::string& name)
 {
 }
 
+CharacterController2D::~CharacterController2D() {
+    unbindFromWorld();
+}
+
 // ============================================================================
 // ACTORCOMPONENT LIFECYCLE
 // ============================================================================
@@ -34,15 +40,50 @@ void CharacterController2D::initialize() {
 }
 
 void CharacterController2D::update(float deltaTime) {
+    if (m_tileMap) {
+        // Tile mode has no world to step us - run the same fixed steps here
+        m_stepAccumulator += deltaTime;
+        int steps = 0;
+        while (m_stepAccumulator >= m_fixedTimeStep && steps < 5) {
+            fixedUpdate(m_fixedTimeStep);
+            m_stepAccumulator -= m_fixedTimeStep;
+            steps++;
+        }
+        if (steps == 5) {
+            m_stepAccumulator = 0.0f;  // Spiral of death guard, like StepSettings2D
+        }
+        return;
+    }
+    
     if (!m_rigidBody || !m_rigidBody->isInitialized()) return;
     
+    // Movement itself runs in fixedUpdate() - just follow the body's world
+    // (it changes when the rigid body is recreated in another scene)
+    if (m_boundWorld != m_rigidBody->getWorld()) {
+        unbindFromWorld();
+        bindToWorld();
+    }
+}
+
+void CharacterController2D::shutdown() {
+    unbindFromWorld();
+}
+
+void CharacterController2D::fixedUpdate(float fixedDeltaTime) {
+    if (!isEnabled()) return;
+    if (!m_tileMap && (!m_rigidBody || !m_rigidBody->isInitialized())) return;
+    
     // Store previous grounded state
     m_wasGrounded = m_isGrounded;
     
     // Update states
-    updateGroundedState();
-    updateMovement(deltaTime);
-    updateJump(deltaTime);
+    updateGroundedState(fixedDeltaTime);
+    updateMovement(fixedDeltaTime);
+    updateJump(fixedDeltaTime);
+    
+    if (m_tileMap) {
+        moveOnTiles(fixedDeltaTime);
+    }
     
     // Reset air jumps when landing
     if (m_isGrounded && !m_wasGrounded) {
@@ -51,6 +92,34 @@ void CharacterController2D::update(float deltaTime) {
     }
 }
 
+void CharacterController2D::bindToWorld() {
+    physics::PhysicsWorld2D* world = m_rigidBody ? m_rigidBody->getWorld() : nullptr;
+    if (!world) return;
+    
+    m_boundWorld = world;
+    m_stepCallbackId = world->addPreStepCallback([this](float dt) {
+        fixedUpdate(dt);
+    });
+}
+
+void CharacterController2D::setTileMap(TileMapLayer* tileMap) {
+    if (tileMap && !m_tileMap) {
+        // Take over the body's motion (if any) so switching modes is seamless
+        unbindFromWorld();
+        m_velocity = (m_rigidBody && m_rigidBody->isInitialized()) ? m_rigidBody->getVelocity() : glm::vec2(0.0f);
+        m_stepAccumulator = 0.0f;
+    }
+    m_tileMap = tileMap;
+}
+
+void CharacterController2D::unbindFromWorld() {
+    if (m_boundWorld && m_boundWorld->isInitialized()) {
+        m_boundWorld->removePreStepCallback(m_stepCallbackId);
+    }
+    m_boundWorld = nullptr;
+    m_stepCallbackId = 0;
+}
+
 // ============================================================================
 // MOVEMENT ACTIONS
 // ============================================================================
@@ -73,13 +142,9 @@ void CharacterController2D::jump() {
 void CharacterController2D::releaseJump() {
     m_jumpReleased = true;
     
-    // Cut jump short if still going up
+    // Cut jump short if still going up (applied on the next fixed step)
     if (m_isJumping && !m_isGrounded) {
-        glm::vec2 vel = m_rigidBody->getVelocity();
-        if (vel.y < 0) { // Moving up (negative Y in screen coords)
-            vel.y *= m_jumpCutMultiplier;
-            m_rigidBody->setVelocity(vel);
-        }
+        m_jumpCutPending = true;
     }
 }
 
@@ -88,22 +153,33 @@ void CharacterController2D::releaseJump() {
 // ============================================================================
 
 bool CharacterController2D::isFalling() const {
-    if (!m_rigidBody) return false;
-    glm::vec2 vel = m_rigidBody->getVelocity();
+    glm::vec2 vel = readVelocity();
     return vel.y > 0 && !m_isGrounded; // Positive Y = falling (screen coords)
 }
 
 bool CharacterController2D::isMoving() const {
-    if (!m_rigidBody) return false;
-    glm::vec2 vel = m_rigidBody->getVelocity();
+    glm::vec2 vel = readVelocity();
     return std::abs(vel.x) > 10.0f;
 }
 
 glm::vec2 CharacterController2D::getVelocity() const {
+    return readVelocity();
+}
+
+glm::vec2 CharacterController2D::readVelocity() const {
+    if (m_tileMap) return m_velocity;
     if (!m_rigidBody) return {0, 0};
     return m_rigidBody->getVelocity();
 }
 
+void CharacterController2D::writeVelocity(glm::vec2 velocity) {
+    if (m_tileMap) {
+        m_velocity = velocity;
+    } else if (m_rigidBody) {
+        m_rigidBody->setVelocity(velocity);
+    }
+}
+
 void CharacterController2D::setGrounded(bool grounded) {
     m_isGrounded = grounded;
 }
@@ -112,7 +188,23 @@ void CharacterController2D::setGrounded(bool grounded) {
 // INTERNAL UPDATE METHODS
 // ============================================================================
 
-void CharacterController2D::updateGroundedState() {
+void CharacterController2D::updateGroundedState(float deltaTime) {
+    if (m_tileMap) {
+        // Tile mode knows the level - grounded when a solid tile is just below
+        m_isGrounded = m_velocity.y >= 0.0f && probeTileGround();
+    } else {
+        updateBodyGroundedState();
+    }
+    
+    // Update coyote timer
+    if (m_isGrounded) {
+        m_coyoteTimer = m_coyoteTime;
+    } else {
+        m_coyoteTimer -= deltaTime;
+    }
+}
+
+void CharacterController2D::updateBodyGroundedState() {
     // For now, use a simple velocity-based check
     // In a full implementation, this would use raycasting
     glm::vec2 vel = m_rigidBody->getVelocity();
@@ -124,17 +216,10 @@ void CharacterController2D::updateGroundedState() {
     } else if (vel.y > 50.0f) { // Falling fast = not grounded
         m_isGrounded = false;
     }
-    
-    // Update coyote timer
-    if (m_isGrounded) {
-        m_coyoteTimer = m_coyoteTime;
-    } else {
-        m_coyoteTimer -= 1.0f / 60.0f; // Approximate, should use deltaTime
-    }
 }
 
 void CharacterController2D::updateMovement(float deltaTime) {
-    glm::vec2 vel = m_rigidBody->getVelocity();
+    glm::vec2 vel = readVelocity();
     
     float targetSpeed = m_isRunning ? m_runSpeed : m_walkSpeed;
     float targetVelX = m_moveInput * targetSpeed;
@@ -148,10 +233,23 @@ void CharacterController2D::updateMovement(float deltaTime) {
     vel.x += movement;
     
     // Set velocity
-    m_rigidBody->setVelocityX(vel.x);
+    if (m_tileMap) {
+        m_velocity.x = vel.x;
+    } else {
+        m_rigidBody->setVelocityX(vel.x);
+    }
 }
 
 void CharacterController2D::updateJump(float deltaTime) {
+    if (m_jumpCutPending) {
+        m_jumpCutPending = false;
+        glm::vec2 vel = readVelocity();
+        if (vel.y < 0) { // Moving up (negative Y in screen coords)
+            vel.y *= m_jumpCutMultiplier;
+            writeVelocity(vel);
+        }
+    }
+    
     // Decrease jump buffer
     if (m_jumpBufferTimer > 0) {
         m_jumpBufferTimer -= deltaTime;
@@ -174,9 +272,9 @@ void CharacterController2D::updateJump(float deltaTime) {
     
     // Execute jump
     if (canJump && !m_jumpReleased) {
-        glm::vec2 vel = m_rigidBody->getVelocity();
+        glm::vec2 vel = readVelocity();
         vel.y = -m_jumpForce; // Negative Y = up (screen coords)
-        m_rigidBody->setVelocity(vel);
+        writeVelocity(vel);
         
         m_isJumping = true;
         m_jumpBufferTimer = 0;
@@ -192,4 +290,54 @@ void CharacterController2D::applyGravityModifiers() {
     // For now, Box2D handles gravity
 }
 
+// ============================================================================
+// TILE MODE
+// ============================================================================
+
+void CharacterController2D::moveOnTiles(float deltaTime) {
+    if (!m_owner) return;
+    
+    m_velocity.y = std::min(m_velocity.y + m_gravity * deltaTime, m_maxFallSpeed);
+    
+    // sweepBox works in world pixels - sweep from the global position
+    Transform2D global = m_owner->getGlobalTransform();
+    Vec2 center = global.position;
+    glm::vec2 half = m_collisionSize * 0.5f;
+    
+    // Resolve one axis at a time so the character slides along walls/floors
+    float dx = m_velocity.x * deltaTime;
+    float allowedX = m_tileMap->sweepBox(center.x - half.x, center.y - half.y,
+                                         center.x + half.x, center.y + half.y, 0, dx);
+    if (allowedX != dx) m_velocity.x = 0.0f;
+    center.x += allowedX;
+    
+    float dy = m_velocity.y * deltaTime;
+    float allowedY = m_tileMap->sweepBox(center.x - half.x, center.y - half.y,
+                                         center.x + half.x, center.y + half.y, 1, dy);
+    if (allowedY != dy) {
+        // Landed (moving down) or hit a ceiling (moving up)
+        if (dy > 0.0f) m_isGrounded = true;
+        m_velocity.y = 0.0f;
+    }
+    center.y += allowedY;
+    
+    // Back into the parent's space before writing the local position
+    if (ActorObject* parent = m_owner->getParent()) {
+        global.position = center;
+        m_owner->setPosition(global.relativeTo(parent->getGlobalTransform()).position);
+    } else {
+        m_owner->setPosition(center);
+    }
+}
+
+bool CharacterController2D::probeTileGround() const {
+    if (!m_owner) return false;
+    
+    Vec2 center = m_owner->getGlobalPosition();
+    glm::vec2 half = m_collisionSize * 0.5f;
+    float allowed = m_tileMap->sweepBox(center.x - half.x, center.y - half.y,
+                                        center.x + half.x, center.y + half.y, 1, m_groundCheckDistance);
+    return allowed < m_groundCheckDistance;
+}
+
 } // namespace engine
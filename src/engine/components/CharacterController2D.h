@@ -3,7 +3,8 @@
  * @brief Platformer character controller with walk, run, jump
  * 
  * Provides high-level character movement for 2D platformers.
- * Works with RigidBody2DComponent for physics-based movement.
+ * Works with RigidBody2DComponent for physics-based movement, or without
+ * a rigid body against a TileMapLayer (see setTileMap()).
  */
 #pragma once
 
@@ -14,6 +15,8 @@
 namespace engine {
 
 class RigidBody2DComponent;
+class TileMapLayer;
+namespace physics { class PhysicsWorld2D; }
 
 /**
  * @brief Platformer character controller
@@ -26,11 +29,23 @@ class RigidBody2DComponent;
  *   // In update:
  *   controller->move(inputX);  // -1 to 1
  *   if (jumpPressed) controller->jump();
+ * 
+ * Velocity changes run from PhysicsWorld2D's pre-step callback with the
+ * fixed timestep, so jump height and coyote/buffer windows are identical
+ * at any frame rate. update() only registers with the world.
+ * 
+ * Tile mode: with setTileMap() the controller needs no rigid body. It
+ * keeps its own velocity, applies gravity and moves the actor with
+ * swept-AABB tests against the layer's solid tiles (x first, then y),
+ * stepping itself at the same fixed timestep. Coyote time, jump buffering
+ * and air jumps behave the same as with Box2D. Meant for large numbers of
+ * simple characters (enemies) that only collide with level geometry.
+ * The actor position is the box center.
  */
 class CharacterController2D : public ActorComponent {
 public:
     CharacterController2D(const std::string& name = "CharacterController2D");
-    virtual ~CharacterController2D() = default;
+    virtual ~CharacterController2D();
     
     // ========================================================================
     // ACTORCOMPONENT LIFECYCLE
@@ -38,6 +53,13 @@ public:
     
     void initialize() override;
     void update(float deltaTime) override;
+    void shutdown() override;
+    
+    /**
+     * @brief Apply movement and jump for one physics step
+     * Called by PhysicsWorld2D before each fixed step
+     */
+    void fixedUpdate(float fixedDeltaTime);
     
     // ========================================================================
     // MOVEMENT SETTINGS
@@ -111,6 +133,34 @@ public:
     float getFacingDirection() const { return m_facingDirection; }
     glm::vec2 getVelocity() const;
     
+    // ========================================================================
+    // TILE MODE
+    // ========================================================================
+    
+    /**
+     * @brief Collide against a tile layer instead of a RigidBody2DComponent
+     * @param tileMap Layer to collide with (nullptr = back to rigid body mode);
+     *                must outlive the controller or be cleared first
+     */
+    void setTileMap(TileMapLayer* tileMap);
+    TileMapLayer* getTileMap() const { return m_tileMap; }
+    bool isTileMode() const { return m_tileMap != nullptr; }
+    
+    /** @brief Collision box size in tile mode (pixels) */
+    void setCollisionSize(float width, float height) { m_collisionSize = {width, height}; }
+    glm::vec2 getCollisionSize() const { return m_collisionSize; }
+    
+    /** @brief Downward acceleration in tile mode (pixels/sec², Box2D world default) */
+    void setGravity(float gravity) { m_gravity = gravity; }
+    float getGravity() const { return m_gravity; }
+    
+    void setMaxFallSpeed(float speed) { m_maxFallSpeed = speed; }
+    float getMaxFallSpeed() const { return m_maxFallSpeed; }
+    
+    /** @brief Fixed step used in tile mode */
+    void setFixedTimeStep(float step) { m_fixedTimeStep = step; }
+    float getFixedTimeStep() const { return m_fixedTimeStep; }
+    
     // ========================================================================
     // GROUND DETECTION
     // ========================================================================
@@ -124,12 +174,22 @@ public:
     void setGrounded(bool grounded);
     
 private:
-    void updateGroundedState();
+    void bindToWorld();
+    void unbindFromWorld();
+    void updateGroundedState(float deltaTime);
+    void updateBodyGroundedState();
     void updateMovement(float deltaTime);
     void updateJump(float deltaTime);
     void applyGravityModifiers();
+    void moveOnTiles(float deltaTime);
+    bool probeTileGround() const;
+    
+    glm::vec2 readVelocity() const;
+    void writeVelocity(glm::vec2 velocity);
     
     RigidBody2DComponent* m_rigidBody = nullptr;
+    physics::PhysicsWorld2D* m_boundWorld = nullptr;
+    int m_stepCallbackId = 0;
     
     // Movement settings
     float m_walkSpeed = 200.0f;
@@ -147,12 +207,22 @@ private:
     // Ground detection
     float m_groundCheckDistance = 2.0f;
     
+    // Tile mode
+    TileMapLayer* m_tileMap = nullptr;
+    glm::vec2 m_collisionSize{24.0f, 48.0f};
+    glm::vec2 m_velocity{0.0f, 0.0f};
+    float m_gravity = 980.0f;
+    float m_maxFallSpeed = 1000.0f;
+    float m_fixedTimeStep = 1.0f / 60.0f;
+    float m_stepAccumulator = 0.0f;
+    
     // State
     float m_moveInput = 0.0f;
     bool m_isRunning = false;
     bool m_isGrounded = false;
     bool m_isJumping = false;
     bool m_jumpReleased = true;
+    bool m_jumpCutPending = false;
     int m_airJumpsRemaining = 0;
     float m_coyoteTimer = 0.0f;
     float m_jumpBufferTimer = 0.0f;
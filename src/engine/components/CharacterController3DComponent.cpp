@@ -57,6 +57,7 @@ bool CharacterController3DComponent::initializePhysics(physics::PhysicsWorld3D*
         LOG_ERROR("[CharacterController3D] Failed to create controller");
         return false;
     }
+    m_moved = true;
     
     LOG_INFO("[CharacterController3D] Initialized at (" + 
              std::to_string(position.x) + ", " + 
@@ -81,8 +82,15 @@ void CharacterController3DComponent::move(const glm::vec3& displacement, float d
     PxVec3 disp(displacement.x, displacement.y - 0.01f, displacement.z);
     
     PxControllerFilters filters;
+    PxExtendedVec3 before = m_controller->getPosition();
     PxControllerCollisionFlags flags = m_controller->move(disp, 0.0001f, deltaTime, filters);
     
+    // The constant ground probe leaves a standing capsule where it was
+    PxExtendedVec3 after = m_controller->getPosition();
+    if (after.x != before.x || after.y != before.y || after.z != before.z) {
+        m_moved = true;
+    }
+    
     // Update grounded state from collision flags
     if (flags & PxControllerCollisionFlag::eCOLLISION_DOWN) {
         m_isGrounded = true;
@@ -110,6 +118,7 @@ void CharacterController3DComponent::setPosition(const glm::vec3& position) {
     if (!m_controller) return;
     
     m_controller->setPosition(PxExtendedVec3(position.x, position.y, position.z));
+    m_moved = true;
 }
 
 void CharacterController3DComponent::setCapsuleSize(float radius, float height) {
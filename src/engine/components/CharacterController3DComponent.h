@@ -114,6 +114,16 @@ public:
     /** @brief Teleport to position */
     void setPosition(const glm::vec3& position);
     
+    /**
+     * @brief True once after move()/setPosition() changed the position
+     * Lets the owner skip the pose write-back on frames the capsule stood still.
+     */
+    bool consumeMoved() {
+        bool moved = m_moved;
+        m_moved = false;
+        return moved;
+    }
+    
     // ========================================================================
     // UPDATE
     // ========================================================================
@@ -134,6 +144,7 @@ private:
     glm::vec3 m_moveInput{0, 0, 0};
     bool m_isGrounded = false;
     bool m_jumpRequested = false;
+    bool m_moved = false;
     
     // Configuration
     float m_moveSpeed = 5.0f;       // Units per second
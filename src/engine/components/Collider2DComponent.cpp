@@ -4,6 +4,7 @@
  */
 #include "Collider2DComponent.h"
 #include "RigidBody2DComponent.h"
+#include "TriggerComponent.h"
 #include "engine/core/ActorObjectExtended.h"
 #include <iostream>
 
@@ -17,6 +18,7 @@ Collider2DComponent::Collider2DComponent(const std::string& name)
     : ActorComponent(name)
     , m_shapeId(b2_nullShapeId)
 {
+    setCanEverTick(false);
 }
 
 Collider2DComponent::~Collider2DComponent() {
@@ -196,9 +198,22 @@ void Collider2DComponent::createShape() {
     if (m_shapeInitialized) {
         std::cout << "[Collider2DComponent] Shape created: " 
                   << m_size.x << "x" << m_size.y << std::endl;
+        
+        // TriggerComponent added before the shape existed - register it now
+        if (m_isTrigger) {
+            if (auto* owner = dynamic_cast<ActorObjectExtended*>(m_owner)) {
+                if (auto* trigger = owner->getComponent<TriggerComponent>()) {
+                    trigger->attachSensor(m_rigidBody->getWorld(), m_shapeId);
+                }
+            }
+        }
     }
 }
 
+physics::PhysicsWorld2D* Collider2DComponent::getWorld() const {
+    return m_rigidBody ? m_rigidBody->getWorld() : nullptr;
+}
+
 void Collider2DComponent::destroyShape() {
     if (m_shapeInitialized && m_rigidBody && m_rigidBody->getWorld()) {
         m_rigidBody->getWorld()->removeShape(m_shapeId);
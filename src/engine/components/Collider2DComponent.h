@@ -89,6 +89,9 @@ public:
     void initializeShape();
     bool isInitialized() const { return m_shapeInitialized; }
     
+    b2ShapeId getShapeId() const { return m_shapeId; }
+    physics::PhysicsWorld2D* getWorld() const;
+    
 private:
     void createShape();
     void destroyShape();
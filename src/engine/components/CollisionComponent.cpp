@@ -16,8 +16,8 @@ CollisionComponent::CollisionComponent(const std::string& name)
 bool CollisionComponent::checkCollision(CollisionComponent* other) {
     if (!other || !m_owner || !other->getOwner()) return false;
     
-    Vec2 posA = m_owner->getPosition() + m_offset;
-    Vec2 posB = other->getOwner()->getPosition() + other->getOffset();
+    Vec2 posA = m_owner->getGlobalPosition() + m_offset;
+    Vec2 posB = other->getOwner()->getGlobalPosition() + other->getOffset();
     
     if (m_shape == CollisionShape::Box && other->getShape() == CollisionShape::Box) {
         // AABB collision
@@ -37,4 +37,30 @@ bool CollisionComponent::checkCollision(CollisionComponent* other) {
     return false;
 }
 
+SDL_Rect CollisionComponent::getWorldBounds() const {
+    Vec2 pos = m_owner ? m_owner->getGlobalPosition() + m_offset : m_offset;
+    
+    float minX = pos.x;
+    float minY = pos.y;
+    float maxX = pos.x + m_size.x;
+    float maxY = pos.y + m_size.y;
+    
+    if (m_shape == CollisionShape::Circle) {
+        minX = pos.x - m_radius;
+        minY = pos.y - m_radius;
+        maxX = pos.x + m_radius;
+        maxY = pos.y + m_radius;
+    }
+    
+    // Round outwards so the integer box always contains the shape
+    int left = static_cast<int>(std::floor(minX));
+    int top = static_cast<int>(std::floor(minY));
+    return SDL_Rect{
+        left,
+        top,
+        static_cast<int>(std::ceil(maxX)) - left,
+        static_cast<int>(std::ceil(maxY)) - top
+    };
+}
+
 } // namespace engine
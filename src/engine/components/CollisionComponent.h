@@ -41,8 +41,16 @@ public:
     
     void setOnCollision(CollisionCallback callback) { m_onCollision = callback; }
     
+    /** @brief Invoke the collision callback (used by CollisionSystem) */
+    void notifyCollision(ActorObject* other) {
+        if (m_onCollision) m_onCollision(other);
+    }
+    
     bool checkCollision(CollisionComponent* other);
     
+    /** @brief World-space bounding box (box, or circle around owner + offset) */
+    SDL_Rect getWorldBounds() const;
+    
 private:
     CollisionShape m_shape = CollisionShape::Box;
     Vec2 m_size{32, 32};
@@ -10,6 +10,7 @@ namespace engine {
 MeshComponent::MeshComponent(const std::string& name)
     : ActorComponent(name)
 {
+    setCanEverTick(false);
 }
 
 void MeshComponent::initialize() {
@@ -27,6 +28,7 @@ void MeshComponent::update(float deltaTime) {
 void MeshComponent::setPrimitive(PrimitiveMeshType type) {
     m_primitiveType = type;
     m_meshPath.clear();  // Clear custom path when using primitive
+    m_collisionMesh.reset();
     
     // Set default scale based on primitive
     switch (type) {
@@ -53,6 +55,9 @@ void MeshComponent::setPrimitive(PrimitiveMeshType type) {
 }
 
 void MeshComponent::setMeshPath(const std::string& path) {
+    if (path != m_meshPath) {
+        m_collisionMesh.reset();  // Belongs to the previous mesh
+    }
     m_meshPath = path;
     m_primitiveType = PrimitiveMeshType::Custom;
     LOG_DEBUG("[MeshComponent] Set mesh path: " + path);
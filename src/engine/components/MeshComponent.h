@@ -8,7 +8,9 @@
 #pragma once
 
 #include "engine/core/ActorComponent.h"
+#include "engine/physics/physx/CookedMeshCache.h"
 #include <glm/glm.hpp>
+#include <memory>
 #include <string>
 
 namespace engine {
@@ -76,9 +78,18 @@ public:
     glm::vec3 getHalfExtents() const { return m_scale * 0.5f; }
     float getRadius() const { return glm::max(m_scale.x, glm::max(m_scale.y, m_scale.z)) * 0.5f; }
     
+    /**
+     * @brief Collision geometry for Custom meshes (unscaled, set by the mesh importer)
+     * Shared so every instance of a mesh hashes to the same cooked data.
+     */
+    void setCollisionMesh(std::shared_ptr<const physics::CollisionMeshData> mesh) { m_collisionMesh = std::move(mesh); }
+    const std::shared_ptr<const physics::CollisionMeshData>& getCollisionMesh() const { return m_collisionMesh; }
+    bool hasCollisionMesh() const { return m_collisionMesh && !m_collisionMesh->empty(); }
+    
 private:
     PrimitiveMeshType m_primitiveType = PrimitiveMeshType::Cube;
     std::string m_meshPath;
+    std::shared_ptr<const physics::CollisionMeshData> m_collisionMesh;
     
     glm::vec3 m_color{0.8f, 0.8f, 0.8f};
     glm::vec3 m_scale{1.0f, 1.0f, 1.0f};
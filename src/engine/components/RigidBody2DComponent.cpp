@@ -17,6 +17,7 @@ RigidBody2DComponent::RigidBody2DComponent(const std::string& name)
     : ActorComponent(name)
     , m_bodyId(b2_nullBodyId)
 {
+    setCanEverTick(false);
 }
 
 RigidBody2DComponent::~RigidBody2DComponent() {
@@ -37,10 +38,8 @@ void RigidBody2DComponent::shutdown() {
 }
 
 void RigidBody2DComponent::update(float deltaTime) {
-    if (!m_bodyInitialized || !m_owner) return;
-    
-    // Sync Actor position FROM Box2D body
-    syncActorFromBody();
+    // Actor position is written by PhysicsWorld2D::step, and only for
+    // bodies Box2D reported as moved (see BodyDef2D::syncActor)
 }
 
 // ============================================================================
@@ -90,6 +89,7 @@ void RigidBody2DComponent::createBody() {
     def.linearDamping = m_linearDamping;
     def.linearVelocity = m_initialVelocity;
     def.userData = m_owner;
+    def.syncActor = true;
     
     m_bodyId = m_world->createBody(def);
     m_bodyInitialized = b2Body_IsValid(m_bodyId);
@@ -108,13 +108,6 @@ void RigidBody2DComponent::destroyBody() {
     }
 }
 
-void RigidBody2DComponent::syncActorFromBody() {
-    if (!m_bodyInitialized || !m_owner) return;
-    
-    glm::vec2 bodyPos = m_world->getBodyPosition(m_bodyId);
-    m_owner->setPosition(Vec2(bodyPos.x, bodyPos.y));
-}
-
 void RigidBody2DComponent::syncBodyFromActor() {
     if (!m_bodyInitialized || !m_owner) return;
     
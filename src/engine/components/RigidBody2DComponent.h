@@ -87,6 +87,7 @@ public:
     // POSITION (synced with Actor)
     // ========================================================================
     
+    /** @brief Simulated position (the actor shows the interpolated render pose) */
     glm::vec2 getPosition() const;
     void setPosition(glm::vec2 position);
     
@@ -100,7 +101,6 @@ public:
 private:
     void createBody();
     void destroyBody();
-    void syncActorFromBody();
     void syncBodyFromActor();
     
     physics::PhysicsWorld2D* m_world = nullptr;
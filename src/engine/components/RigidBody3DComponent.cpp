@@ -13,9 +13,29 @@ using namespace physx;
 
 namespace engine {
 
+namespace {
+
+glm::vec3 toEuler(const PxQuat& q) {
+    float sinr_cosp = 2.0f * (q.w * q.x + q.y * q.z);
+    float cosr_cosp = 1.0f - 2.0f * (q.x * q.x + q.y * q.y);
+    float roll = std::atan2(sinr_cosp, cosr_cosp);
+    
+    float sinp = 2.0f * (q.w * q.y - q.z * q.x);
+    float pitch = std::abs(sinp) >= 1.0f ? std::copysign(3.14159f / 2.0f, sinp) : std::asin(sinp);
+    
+    float siny_cosp = 2.0f * (q.w * q.z + q.x * q.y);
+    float cosy_cosp = 1.0f - 2.0f * (q.y * q.y + q.z * q.z);
+    float yaw = std::atan2(siny_cosp, cosy_cosp);
+    
+    return glm::vec3(roll, pitch, yaw);
+}
+
+} // namespace
+
 RigidBody3DComponent::RigidBody3DComponent(const std::string& name)
     : ActorComponent(name)
 {
+    setCanEverTick(false);
 }
 
 RigidBody3DComponent::~RigidBody3DComponent() {
@@ -31,8 +51,16 @@ void RigidBody3DComponent::shutdown() {
 }
 
 void RigidBody3DComponent::update(float deltaTime) {
-    if (m_bodyInitialized && m_bodyType == BodyType::Dynamic) {
-        syncActorFromBody();
+    // Pose sync happens in onBodyMoved(), only for bodies PhysX moved
+}
+
+void RigidBody3DComponent::onBodyMoved(const glm::vec3& position, const glm::quat& rotation) {
+    if (!m_bodyInitialized) return;
+    
+    if (m_onMoved) {
+        m_onMoved(position, toEuler(PxQuat(rotation.x, rotation.y, rotation.z, rotation.w)));
+    } else {
+        syncActorFromBody(position);
     }
 }
 
@@ -74,6 +102,10 @@ void RigidBody3DComponent::createBody() {
     if (m_actor) {
         attachShape();
         m_bodyInitialized = true;
+        
+        if (m_bodyType != BodyType::Static) {
+            m_world->setMoveListener(m_actor, this);
+        }
     }
 }
 
@@ -90,6 +122,21 @@ void RigidBody3DComponent::attachShape() {
         case ShapeType::Capsule:
             m_world->addCapsuleShape(m_actor, m_capsuleRadius, m_capsuleHalfHeight);
             break;
+        case ShapeType::ConvexMesh:
+        case ShapeType::TriangleMesh: {
+            PxShape* shape = nullptr;
+            if (m_collisionMesh) {
+                bool triangles = m_shapeType == ShapeType::TriangleMesh && m_bodyType != BodyType::Dynamic;
+                shape = triangles
+                    ? m_world->addTriangleMeshShape(m_actor, *m_collisionMesh, m_meshScale)
+                    : m_world->addConvexMeshShape(m_actor, *m_collisionMesh, m_meshScale);
+            }
+            if (!shape) {
+                std::cerr << "[RigidBody3DComponent] No collision mesh, using box: " << getName() << std::endl;
+                m_world->addBoxShape(m_actor, m_boxHalfExtents);
+            }
+            break;
+        }
     }
 }
 
@@ -101,15 +148,13 @@ void RigidBody3DComponent::destroyBody() {
     m_bodyInitialized = false;
 }
 
-void RigidBody3DComponent::syncActorFromBody() {
-    if (!m_actor || !m_bodyInitialized) return;
-    
+void RigidBody3DComponent::syncActorFromBody(const glm::vec3& position) {
     auto* owner = getOwner();
     if (!owner) return;
     
-    glm::vec3 pos = m_world->getBodyPosition(m_actor);
-    owner->setPosition(pos.x, pos.y);
-    // TODO: Sync 3D position when Actor supports it
+    // Inverse of createBody(): physics X → 2D X, physics Z → 2D Y, physics Y → actor Z
+    owner->setPosition(position.x * 100.0f, position.z * 100.0f);
+    owner->setZ(position.y * 100.0f);
 }
 
 void RigidBody3DComponent::syncBodyFromActor() {
@@ -234,22 +279,8 @@ void RigidBody3DComponent::setPosition(const glm::vec3& position) {
 glm::vec3 RigidBody3DComponent::getRotation() const {
     if (!m_actor) return glm::vec3(0);
     
-    PxTransform transform = m_actor->getGlobalPose();
     // Convert quaternion to euler (simplified)
-    PxQuat q = transform.q;
-    
-    float sinr_cosp = 2.0f * (q.w * q.x + q.y * q.z);
-    float cosr_cosp = 1.0f - 2.0f * (q.x * q.x + q.y * q.y);
-    float roll = std::atan2(sinr_cosp, cosr_cosp);
-    
-    float sinp = 2.0f * (q.w * q.y - q.z * q.x);
-    float pitch = std::abs(sinp) >= 1.0f ? std::copysign(3.14159f / 2.0f, sinp) : std::asin(sinp);
-    
-    float siny_cosp = 2.0f * (q.w * q.z + q.x * q.y);
-    float cosy_cosp = 1.0f - 2.0f * (q.y * q.y + q.z * q.z);
-    float yaw = std::atan2(siny_cosp, cosy_cosp);
-    
-    return glm::vec3(roll, pitch, yaw);
+    return toEuler(m_actor->getGlobalPose().q);
 }
 
 void RigidBody3DComponent::setRotation(const glm::vec3& rotation) {
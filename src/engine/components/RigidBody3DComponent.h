@@ -8,7 +8,10 @@
 #pragma once
 
 #include "engine/core/ActorComponent.h"
+#include "engine/physics/physx/PhysicsWorld3D.h"
 #include <glm/glm.hpp>
+#include <functional>
+#include <memory>
 
 namespace physx {
     class PxRigidDynamic;
@@ -17,7 +20,6 @@ namespace physx {
 }
 
 namespace engine {
-namespace physics { class PhysicsWorld3D; }
 
 /**
  * @brief 3D Rigid body component using PhysX
@@ -26,8 +28,11 @@ namespace physics { class PhysicsWorld3D; }
  *   auto* rb = actor->addComponent<RigidBody3DComponent>();
  *   rb->setBodyType(RigidBody3DComponent::BodyType::Dynamic);
  *   rb->initializeBody(physicsWorld3D);
+ * 
+ * Dynamic and kinematic bodies sync back only when PhysX reports them as
+ * active after a step; sleeping bodies cost nothing per frame.
  */
-class RigidBody3DComponent : public ActorComponent {
+class RigidBody3DComponent : public ActorComponent, public physics::BodyMoveListener3D {
 public:
     enum class BodyType {
         Static,     // Doesn't move (ground, walls)
@@ -38,7 +43,9 @@ public:
     enum class ShapeType {
         Box,
         Sphere,
-        Capsule
+        Capsule,
+        ConvexMesh,     // Convex hull of the collision mesh
+        TriangleMesh    // Exact mesh, static/kinematic only (dynamic falls back to ConvexMesh)
     };
     
     RigidBody3DComponent(const std::string& name = "RigidBody3DComponent");
@@ -83,6 +90,16 @@ public:
         m_capsuleRadius = radius; 
         m_capsuleHalfHeight = halfHeight; 
     }
+    float getCapsuleRadius() const { return m_capsuleRadius; }
+    float getCapsuleHalfHeight() const { return m_capsuleHalfHeight; }
+    
+    /** @brief Geometry for ConvexMesh/TriangleMesh shapes, cooked via the world's mesh cache */
+    void setCollisionMesh(std::shared_ptr<const physics::CollisionMeshData> mesh, const glm::vec3& scale = glm::vec3(1.0f)) {
+        m_collisionMesh = std::move(mesh);
+        m_meshScale = scale;
+    }
+    const std::shared_ptr<const physics::CollisionMeshData>& getCollisionMesh() const { return m_collisionMesh; }
+    glm::vec3 getMeshScale() const { return m_meshScale; }
     
     // ========================================================================
     // PHYSICS PROPERTIES
@@ -124,6 +141,16 @@ public:
     glm::vec3 getRotation() const;  // Euler angles
     void setRotation(const glm::vec3& rotation);
     
+    /**
+     * @brief Called with the new pose (meters, Euler angles) when the body moved
+     * Without a callback the owner's 2D position and Z are written directly.
+     */
+    using MovedCallback = std::function<void(const glm::vec3& position, const glm::vec3& rotation)>;
+    void setOnMoved(MovedCallback callback) { m_onMoved = std::move(callback); }
+    
+    /** @brief BodyMoveListener3D - invoked from PhysicsWorld3D::endStep() */
+    void onBodyMoved(const glm::vec3& position, const glm::quat& rotation) override;
+    
     // ========================================================================
     // PHYSX ACCESS
     // ========================================================================
@@ -135,7 +162,7 @@ public:
 private:
     void createBody();
     void destroyBody();
-    void syncActorFromBody();
+    void syncActorFromBody(const glm::vec3& position);
     void syncBodyFromActor();
     void attachShape();
     
@@ -156,9 +183,13 @@ private:
     float m_sphereRadius = 0.5f;
     float m_capsuleRadius = 0.5f;
     float m_capsuleHalfHeight = 0.5f;
+    std::shared_ptr<const physics::CollisionMeshData> m_collisionMesh;
+    glm::vec3 m_meshScale{1.0f, 1.0f, 1.0f};
     
     // Cached initial values
     glm::vec3 m_initialVelocity{0, 0, 0};
+    
+    MovedCallback m_onMoved;
 };
 
 } // namespace engine
@@ -23,18 +23,12 @@ SpriteComponent::SpriteComponent(const std::string& name)
 void SpriteComponent::render(SDL_Renderer* renderer) {
     if (!m_texture || !renderer) return;
     
-    // Get transform from owner actor (not component's own position)
-    Vec2 pos = m_position;  // Start with component's local offset
+    // Position follows the owner actor (and any parent component); rotation
+    // and scale stay the sprite's own, so actor scale doesn't resize sprites
+    Vec2 pos = getWorldTransform().position;
     float rotation = getRotation();
     Vec2 scale = getScale();
     
-    // Add owner's position if available
-    if (m_owner) {
-        Vec2 ownerPos = m_owner->getPosition();
-        pos.x += ownerPos.x;
-        pos.y += ownerPos.y;
-    }
-    
     // Apply scale to size
     int finalW = static_cast<int>(m_width * scale.x);
     int finalH = static_cast<int>(m_height * scale.y);
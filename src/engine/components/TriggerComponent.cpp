@@ -3,44 +3,131 @@
  * @brief Implementation of TriggerComponent
  */
 #include "TriggerComponent.h"
+#include "Collider2DComponent.h"
 #include "engine/core/ActorObjectExtended.h"
+#include <algorithm>
 
 namespace engine {
 
 TriggerComponent::TriggerComponent(const std::string& name)
     : ActorComponent(name) {
+    // Stay callbacks see the overlaps of this frame's physics step
+    setTickGroup(TickGroup::PostPhysics);
+}
+
+TriggerComponent::~TriggerComponent() {
+    detachSensors();
 }
 
 void TriggerComponent::initialize() {
-    // Initialize trigger component - setup callback tracking
+    // Collider set up before us - register on its sensor shape now
+    auto* owner = dynamic_cast<ActorObjectExtended*>(getOwner());
+    if (!owner) return;
+    
+    if (auto* collider = owner->getComponent<Collider2DComponent>()) {
+        if (collider->isTrigger() && collider->isInitialized()) {
+            attachSensor(collider->getWorld(), collider->getShapeId());
+        }
+    }
 }
 
 void TriggerComponent::shutdown() {
+    detachSensors();
     m_overlappingActors.clear();
+    m_visitorShapes.clear();
     m_onEnter = nullptr;
     m_onExit = nullptr;
     m_onStay = nullptr;
 }
 
 void TriggerComponent::update(float deltaTime) {
-    // Update trigger state - call onStay for all currently overlapping actors
-    if (m_onStay) {
-        for (auto* actor : m_overlappingActors) {
-            m_onStay(actor);
+    if (!m_onStay || m_overlappingActors.empty()) {
+        m_stayTimer = 0.0f;
+        return;
+    }
+    
+    m_stayTimer += deltaTime;
+    if (m_stayTimer < m_stayInterval) return;
+    m_stayTimer = 0.0f;
+    
+    // Copy - the callback may move actors out of the trigger
+    std::vector<ActorObjectExtended*> overlapping = m_overlappingActors;
+    for (auto* actor : overlapping) {
+        m_onStay(actor);
+    }
+}
+
+// ============================================================================
+// SENSOR REGISTRATION
+// ============================================================================
+
+void TriggerComponent::attachSensor(physics::PhysicsWorld2D* world, b2ShapeId shapeId) {
+    if (!world) return;
+    
+    for (const auto& sensor : m_sensors) {
+        if (sensor.world == world && B2_ID_EQUALS(sensor.shapeId, shapeId)) return;
+    }
+    
+    world->setSensorListener(shapeId, this);
+    m_sensors.push_back({world, shapeId});
+}
+
+void TriggerComponent::detachSensors() {
+    // The world ignores shapes that were destroyed in the meantime
+    for (const auto& sensor : m_sensors) {
+        sensor.world->setSensorListener(sensor.shapeId, nullptr);
+    }
+    m_sensors.clear();
+}
+
+void TriggerComponent::onSensorBegin(b2ShapeId visitorShape, ActorObject* visitor) {
+    auto* other = dynamic_cast<ActorObjectExtended*>(visitor);
+    if (!other) return;
+    
+    m_visitorShapes.push_back({visitorShape, other});
+    onTriggerEnter(other);
+}
+
+void TriggerComponent::onSensorEnd(b2ShapeId visitorShape, ActorObject*) {
+    // Look the actor up by shape - visitor is nullptr when the shape (and
+    // usually its actor) was destroyed, and the overlap must still end
+    ActorObjectExtended* other = nullptr;
+    for (size_t i = 0; i < m_visitorShapes.size(); i++) {
+        if (B2_ID_EQUALS(m_visitorShapes[i].shapeId, visitorShape)) {
+            other = m_visitorShapes[i].actor;
+            m_visitorShapes[i] = m_visitorShapes.back();
+            m_visitorShapes.pop_back();
+            break;
         }
     }
+    if (!other) return;
+    
+    for (const auto& shape : m_visitorShapes) {
+        if (shape.actor == other) return;  // Another of its shapes is still inside
+    }
+    onTriggerExit(other);
 }
 
+void TriggerComponent::clearOverlaps() {
+    m_overlappingActors.clear();
+    m_visitorShapes.clear();
+    m_stayTimer = 0.0f;
+}
+
+// ============================================================================
+// TRIGGER EVENTS
+// ============================================================================
+
 void TriggerComponent::onTriggerEnter(ActorObjectExtended* other) {
     if (!other) return;
     
     // Check if already tracking this actor
-    if (m_overlappingActors.find(other) != m_overlappingActors.end()) {
+    if (findOverlap(other) >= 0) {
         return;
     }
     
-    // Add to tracking set and fire enter callback
-    m_overlappingActors.insert(other);
+    // Add to tracking and fire enter callback
+    m_overlappingActors.push_back(other);
     if (m_onEnter) {
         m_onEnter(other);
     }
@@ -50,13 +137,17 @@ void TriggerComponent::onTriggerExit(ActorObjectExtended* other) {
     if (!other) return;
     
     // Check if currently tracking this actor
-    auto it = m_overlappingActors.find(other);
-    if (it == m_overlappingActors.end()) {
+    int index = findOverlap(other);
+    if (index < 0) {
         return;
     }
     
-    // Remove from tracking set and fire exit callback
-    m_overlappingActors.erase(it);
+    // Swap-remove from tracking and fire exit callback
+    m_overlappingActors[index] = m_overlappingActors.back();
+    m_overlappingActors.pop_back();
+    m_visitorShapes.erase(std::remove_if(m_visitorShapes.begin(), m_visitorShapes.end(),
+        [other](const VisitorShape& shape) { return shape.actor == other; }), m_visitorShapes.end());
+    
     if (m_onExit) {
         m_onExit(other);
     }
@@ -66,18 +157,24 @@ void TriggerComponent::onTriggerStay(ActorObjectExtended* other) {
     if (!other) return;
     
     // Only fire stay callback if actor is currently overlapping
-    if (m_overlappingActors.find(other) == m_overlappingActors.end()) {
+    if (findOverlap(other) < 0) {
         return;
     }
     
-    // Fire stay callback (also called continuously in update)
     if (m_onStay) {
         m_onStay(other);
     }
 }
 
 bool TriggerComponent::isOverlapping(ActorObjectExtended* actor) const {
-    return m_overlappingActors.find(actor) != m_overlappingActors.end();
+    return findOverlap(actor) >= 0;
+}
+
+int TriggerComponent::findOverlap(ActorObjectExtended* actor) const {
+    for (size_t i = 0; i < m_overlappingActors.size(); i++) {
+        if (m_overlappingActors[i] == actor) return static_cast<int>(i);
+    }
+    return -1;
 }
 
 } // namespace engine
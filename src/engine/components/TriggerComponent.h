@@ -8,8 +8,9 @@
 #pragma once
 
 #include "engine/core/ActorComponent.h"
+#include "engine/physics/box2d/PhysicsWorld2D.h"
 #include <functional>
-#include <unordered_set>
+#include <vector>
 #include <string>
 
 namespace engine {
@@ -27,13 +28,19 @@ class ActorObjectExtended;
  *   trigger->setOnExit([](ActorObjectExtended* other) {
  *       // Handle exit
  *   });
+ * 
+ * The component registers itself as SensorListener2D on the actor's
+ * trigger collider shape (whichever of the two is set up last does the
+ * registration), so PhysicsWorld2D::step delivers enter/exit directly.
+ * onStay is opt-in and runs every frame, or at most every
+ * getStayInterval() seconds when an interval is set.
  */
-class TriggerComponent : public ActorComponent {
+class TriggerComponent : public ActorComponent, public physics::SensorListener2D {
 public:
     using TriggerCallback = std::function<void(ActorObjectExtended* other)>;
     
     TriggerComponent(const std::string& name = "TriggerComponent");
-    virtual ~TriggerComponent() = default;
+    virtual ~TriggerComponent();
     
     // ========================================================================
     // ACTORCOMPONENT LIFECYCLE
@@ -51,6 +58,8 @@ public:
     
     /**
      * @brief Update trigger state - call onStay for overlapping actors
+     * 
+     * Only does work when an onStay callback is set.
      */
     void update(float deltaTime) override;
     
@@ -76,6 +85,28 @@ public:
      */
     void setOnStay(TriggerCallback callback) { m_onStay = callback; }
     
+    /**
+     * @brief Minimum time between onStay calls for the overlapping actors
+     * @param seconds 0 = every frame (default)
+     */
+    void setStayInterval(float seconds) { m_stayInterval = seconds > 0.0f ? seconds : 0.0f; }
+    float getStayInterval() const { return m_stayInterval; }
+    
+    // ========================================================================
+    // SENSOR REGISTRATION
+    // ========================================================================
+    
+    /**
+     * @brief Receive events of a sensor shape (called by Collider2DComponent)
+     * @param world World the shape lives in
+     * @param shapeId Sensor shape
+     */
+    void attachSensor(physics::PhysicsWorld2D* world, b2ShapeId shapeId);
+    
+    // SensorListener2D
+    void onSensorBegin(b2ShapeId visitorShape, ActorObject* visitor) override;
+    void onSensorEnd(b2ShapeId visitorShape, ActorObject* visitor) override;
+    
     // ========================================================================
     // TRIGGER EVENTS (called by physics system)
     // ========================================================================
@@ -88,7 +119,9 @@ public:
     
     /**
      * @brief Called when an actor exits the trigger area
-     * @param other The actor that exited
+     * @param other The actor that exited. When the exit comes from the
+     *              visitor's shape being destroyed, the actor may already be
+     *              gone - compare the pointer, don't dereference it.
      */
     void onTriggerExit(ActorObjectExtended* other);
     
@@ -111,9 +144,9 @@ public:
     
     /**
      * @brief Get all currently overlapping actors
-     * @return Set of overlapping actors
+     * @return Overlapping actors, in the order they entered
      */
-    const std::unordered_set<ActorObjectExtended*>& getOverlappingActors() const { return m_overlappingActors; }
+    const std::vector<ActorObjectExtended*>& getOverlappingActors() const { return m_overlappingActors; }
     
     /**
      * @brief Get the number of overlapping actors
@@ -121,6 +154,14 @@ public:
      */
     size_t getOverlapCount() const { return m_overlappingActors.size(); }
     
+    /**
+     * @brief Forget all overlaps without calling onExit
+     *
+     * Used when the sensor's body is disabled (scene change), so the next
+     * overlap after re-enabling fires onEnter again.
+     */
+    void clearOverlaps();
+    
     // ========================================================================
     // FILTER SETTINGS
     // ========================================================================
@@ -144,11 +185,34 @@ public:
     bool hasFilterTag() const { return !m_filterTag.empty(); }
     
 private:
+    struct SensorBinding {
+        physics::PhysicsWorld2D* world = nullptr;
+        b2ShapeId shapeId = b2_nullShapeId;
+    };
+    
+    struct VisitorShape {
+        b2ShapeId shapeId = b2_nullShapeId;
+        ActorObjectExtended* actor = nullptr;
+    };
+    
+    void detachSensors();
+    int findOverlap(ActorObjectExtended* actor) const;
+    
     TriggerCallback m_onEnter;
     TriggerCallback m_onExit;
     TriggerCallback m_onStay;
     
-    std::unordered_set<ActorObjectExtended*> m_overlappingActors;
+    // Overlaps are few per trigger - flat arrays beat a hash set here.
+    // m_visitorShapes records which actor each shape inside belongs to, so
+    // an end event for a destroyed shape (no userData left) still finds its
+    // actor, and an actor with several shapes exits when its last one leaves.
+    std::vector<ActorObjectExtended*> m_overlappingActors;
+    std::vector<VisitorShape> m_visitorShapes;
+    std::vector<SensorBinding> m_sensors;
+    
+    float m_stayInterval = 0.0f;
+    float m_stayTimer = 0.0f;
+    
     std::string m_filterTag;  // Only trigger for actors with this tag
 };
 
@@ -3,6 +3,9 @@
  * @brief Component System Implementation
  */
 #include "ActorComponent.h"
+#include "ActorObject.h"
+#include "TickManager.h"
+#include <algorithm>
 
 namespace engine {
 
@@ -17,6 +20,23 @@ ActorComponent::ActorComponent(const std::string& name)
 {
 }
 
+void ActorComponent::setCanEverTick(bool canTick) {
+    if (m_canEverTick == canTick) return;
+    
+    if (m_tickManager) m_tickManager->unlink(this);
+    m_canEverTick = canTick;
+    if (m_tickManager) m_tickManager->link(this);
+}
+
+void ActorComponent::setTickGroup(TickGroup group) {
+    if (m_tickGroup == group) return;
+    
+    // Move to the other group's list
+    if (m_tickManager) m_tickManager->unlink(this);
+    m_tickGroup = group;
+    if (m_tickManager) m_tickManager->link(this);
+}
+
 // ============================================================================
 // SCENE COMPONENT
 // ============================================================================
@@ -30,4 +50,51 @@ SceneComponent::SceneComponent(const std::string& name)
 {
 }
 
+SceneComponent::~SceneComponent() {
+    attachTo(nullptr);
+    for (SceneComponent* child : m_attachChildren) {
+        child->m_parent = nullptr;
+        child->m_transformDirty = true;
+    }
+}
+
+bool SceneComponent::attachTo(SceneComponent* parent) {
+    if (parent == m_parent) return true;
+    for (SceneComponent* p = parent; p; p = p->m_parent) {
+        if (p == this) return false;
+    }
+    
+    if (m_parent) {
+        auto& siblings = m_parent->m_attachChildren;
+        siblings.erase(std::remove(siblings.begin(), siblings.end(), this), siblings.end());
+    }
+    m_parent = parent;
+    if (m_parent) {
+        m_parent->m_attachChildren.push_back(this);
+    }
+    m_transformDirty = true;
+    return true;
+}
+
+const Transform2D& SceneComponent::getWorldTransform() const {
+    // Parents are validated first; each level only compares version numbers
+    Transform2D parentTransform;
+    uint32_t parentVersion = 0;
+    if (m_parent) {
+        parentTransform = m_parent->getWorldTransform();
+        parentVersion = m_parent->m_transformVersion;
+    } else if (m_owner) {
+        parentTransform = m_owner->getGlobalTransform();
+        parentVersion = m_owner->getTransformVersion();
+    }
+    
+    if (m_transformDirty || parentVersion != m_parentVersion) {
+        m_worldTransform = parentTransform * Transform2D{m_position, m_rotation, m_scale};
+        m_parentVersion = parentVersion;
+        m_transformVersion++;
+        m_transformDirty = false;
+    }
+    return m_worldTransform;
+}
+
 } // namespace engine
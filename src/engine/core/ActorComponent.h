@@ -12,8 +12,11 @@
 #pragma once
 
 #include "CoreRedirects.h"
+#include "Transform2D.h"
 #include "Vec2.h"
+#include <cstdint>
 #include <string>
+#include <vector>
 #include <SDL.h>
 
 namespace engine {
@@ -21,6 +24,20 @@ namespace engine {
 // Forward declarations
 // Note: ActorObject is defined in CoreRedirects.h, no forward declaration needed
 class SceneComponent;
+class TickManager;
+
+/**
+ * @brief When a component ticks relative to physics and actor updates
+ *
+ * Order within a frame (see WorldContainer::updateActors / Scene::update):
+ * PrePhysics → physics step → actor update() → PostPhysics → transforms → collisions → PostUpdate
+ */
+enum class TickGroup {
+    PrePhysics,     // Default - input, movement, anything that drives bodies
+    PostPhysics,    // Reacts to the simulated state (triggers, contacts)
+    PostUpdate,     // Everything has moved (cameras, attachments)
+    Count
+};
 
 // ============================================================================
 // ACTOR COMPONENT (Base Component)
@@ -105,9 +122,60 @@ public:
      */
     void setEnabled(bool enabled) { m_enabled = enabled; }
     
+    // ========================================================================
+    // TICKING (like FActorComponentTickFunction in UE5)
+    // ========================================================================
+    
+    /**
+     * @brief Whether update() does anything at all
+     * 
+     * Components that can't tick never enter a tick list. addComponent()
+     * clears this for types that don't override update(); components with
+     * an empty override clear it in their constructor.
+     */
+    bool canEverTick() const { return m_canEverTick; }
+    void setCanEverTick(bool canTick);
+    
+    TickGroup getTickGroup() const { return m_tickGroup; }
+    void setTickGroup(TickGroup group);
+    
+    /**
+     * @brief Seconds between update() calls (0 = every frame)
+     * update() then receives the time accumulated since its last call.
+     */
+    float getTickInterval() const { return m_tickInterval; }
+    void setTickInterval(float seconds) { m_tickInterval = seconds > 0.0f ? seconds : 0.0f; }
+    
+    /** @brief True while a scene's TickManager ticks this component (not the owner's update()) */
+    bool isTickManaged() const { return m_tickManager != nullptr; }
+    
+    /** @brief Call update() if the tick interval has elapsed */
+    void tickComponent(float deltaTime) {
+        if (m_tickInterval <= 0.0f) {
+            update(deltaTime);
+            return;
+        }
+        m_tickAccumulator += deltaTime;
+        if (m_tickAccumulator < m_tickInterval) return;
+        
+        float elapsed = m_tickAccumulator;
+        m_tickAccumulator = 0.0f;
+        update(elapsed);
+    }
+    
 protected:
     ActorObject* m_owner = nullptr; ///< Owning actor
     bool m_enabled = true;          ///< Is component enabled?
+    
+private:
+    friend class TickManager;
+    
+    bool m_canEverTick = true;
+    TickGroup m_tickGroup = TickGroup::PrePhysics;
+    float m_tickInterval = 0.0f;
+    float m_tickAccumulator = 0.0f;
+    TickManager* m_tickManager = nullptr;   ///< Set while the owner is in a container
+    size_t m_tickIndex = SIZE_MAX;          ///< Position in the group's tick list, SIZE_MAX = not listed
 };
 
 // ============================================================================
@@ -130,7 +198,7 @@ protected:
 class SceneComponent : public ActorComponent {
 public:
     SceneComponent(const std::string& name = "SceneComponent");
-    virtual ~SceneComponent() = default;
+    virtual ~SceneComponent();
     
     // ========================================================================
     // TRANSFORM
@@ -146,7 +214,7 @@ public:
      * @brief Set component position
      * @param pos New position
      */
-    void setPosition(Vec2 pos) { m_position = pos; }
+    void setPosition(Vec2 pos) { m_position = pos; m_transformDirty = true; }
     
     /**
      * @brief Get component rotation (degrees)
@@ -158,7 +226,7 @@ public:
      * @brief Set component rotation
      * @param rot Rotation in degrees
      */
-    void setRotation(float rot) { m_rotation = rot; }
+    void setRotation(float rot) { m_rotation = rot; m_transformDirty = true; }
     
     /**
      * @brief Get component scale
@@ -170,18 +238,18 @@ public:
      * @brief Set component scale
      * @param scale New scale
      */
-    void setScale(Vec2 scale) { m_scale = scale; }
+    void setScale(Vec2 scale) { m_scale = scale; m_transformDirty = true; }
     
     // ========================================================================
-    // ATTACHMENT (Future: Full hierarchy support)
+    // ATTACHMENT
     // ========================================================================
     
     /**
-     * @brief Attach to parent component
+     * @brief Attach to parent component (nullptr = relative to the owner actor)
      * @param parent Parent to attach to
-     * @note Not fully implemented yet
+     * @return false if parent is this component or attached below it
      */
-    void attachTo(SceneComponent* parent) { m_parent = parent; }
+    bool attachTo(SceneComponent* parent);
     
     /**
      * @brief Get parent component
@@ -189,11 +257,35 @@ public:
      */
     SceneComponent* getParent() const { return m_parent; }
     
+    // ========================================================================
+    // WORLD TRANSFORM
+    // ========================================================================
+    
+    /**
+     * @brief Transform in world space: parent component's (or else the owner
+     * actor's global transform) combined with this component's
+     * 
+     * Cached - recomputed only when this component or something it is
+     * attached to has changed since the last call.
+     */
+    const Transform2D& getWorldTransform() const;
+    Vec2 getWorldPosition() const { return getWorldTransform().position; }
+    float getWorldRotation() const { return getWorldTransform().rotation; }
+    Vec2 getWorldScale() const { return getWorldTransform().scale; }
+    
 protected:
     Vec2 m_position{0, 0};      ///< Component position
     float m_rotation = 0.0f;    ///< Component rotation (degrees)
     Vec2 m_scale{1.0f, 1.0f};   ///< Component scale
     SceneComponent* m_parent = nullptr; ///< Parent component
+    
+private:
+    std::vector<SceneComponent*> m_attachChildren;  ///< Detached when this component goes away
+    
+    mutable Transform2D m_worldTransform;
+    mutable uint32_t m_parentVersion = 0;       ///< Parent transform version m_worldTransform was built from
+    mutable uint32_t m_transformVersion = 0;    ///< Bumped on every recompute, read by attached children
+    mutable bool m_transformDirty = true;       ///< Local transform or parent changed
 };
 
 } // namespace engine
@@ -0,0 +1,70 @@
+/**
+ * @file ActorIndex.cpp
+ * @brief Actor name/role index implementation
+ */
+#include "ActorIndex.h"
+#include "ActorObjectExtended.h"
+#include <algorithm>
+
+namespace engine {
+
+void ActorIndex::add(ActorObjectExtended* actor) {
+    if (!actor || actor->m_actorIndex == this) return;
+    if (actor->m_actorIndex) actor->m_actorIndex->remove(actor);
+
+    actor->m_actorIndex = this;
+    m_byName[actor->getNameId()].push_back(actor);
+    if (actor->getRole() != ActorRole::None) {
+        m_byRole[static_cast<int>(actor->getRole())].push_back(actor);
+    }
+}
+
+void ActorIndex::remove(ActorObjectExtended* actor) {
+    if (!actor || actor->m_actorIndex != this) return;
+
+    auto it = m_byName.find(actor->getNameId());
+    if (it != m_byName.end()) {
+        erase(it->second, actor);
+        if (it->second.empty()) m_byName.erase(it);
+    }
+    if (actor->getRole() != ActorRole::None) {
+        erase(m_byRole[static_cast<int>(actor->getRole())], actor);
+    }
+    actor->m_actorIndex = nullptr;
+}
+
+ActorObjectExtended* ActorIndex::find(Name name) const {
+    auto it = m_byName.find(name);
+    return it != m_byName.end() ? it->second.front() : nullptr;
+}
+
+ActorObjectExtended* ActorIndex::find(ActorRole role) const {
+    if (role == ActorRole::None || role == ActorRole::Count) return nullptr;
+    const auto& list = m_byRole[static_cast<int>(role)];
+    return list.empty() ? nullptr : list.front();
+}
+
+void ActorIndex::rename(ActorObjectExtended* actor, Name oldName) {
+    auto it = m_byName.find(oldName);
+    if (it != m_byName.end()) {
+        erase(it->second, actor);
+        if (it->second.empty()) m_byName.erase(it);
+    }
+    m_byName[actor->getNameId()].push_back(actor);
+}
+
+void ActorIndex::changeRole(ActorObjectExtended* actor, ActorRole oldRole) {
+    if (oldRole != ActorRole::None) {
+        erase(m_byRole[static_cast<int>(oldRole)], actor);
+    }
+    if (actor->getRole() != ActorRole::None) {
+        m_byRole[static_cast<int>(actor->getRole())].push_back(actor);
+    }
+}
+
+void ActorIndex::erase(std::vector<ActorObjectExtended*>& list, ActorObjectExtended* actor) {
+    // Keeps order - find() returns the earliest added actor
+    list.erase(std::remove(list.begin(), list.end(), actor), list.end());
+}
+
+} // namespace engine
@@ -0,0 +1,57 @@
+/**
+ * @file ActorIndex.h
+ * @brief Name and role lookup for the actors of a WorldContainer
+ */
+#pragma once
+
+#include "Name.h"
+#include <unordered_map>
+#include <vector>
+
+namespace engine {
+
+class ActorObjectExtended;
+
+/**
+ * @brief What an actor is to its scene, instead of magic actor names
+ */
+enum class ActorRole {
+    None,
+    Background,     // Fills the viewport behind everything else
+    PlayerSpawn,    // Where the player enters the scene
+    Count
+};
+
+/**
+ * @brief O(1) actor lookup by interned name and by role
+ *
+ * Owned by WorldContainer and declared before its actors, so it outlives
+ * them. Actors keep it up to date when renamed or given another role.
+ * Several actors may share a name or role; find() returns the one added
+ * first.
+ */
+class ActorIndex {
+public:
+    ActorIndex() = default;
+    ActorIndex(const ActorIndex&) = delete;
+    ActorIndex& operator=(const ActorIndex&) = delete;
+
+    void add(ActorObjectExtended* actor);
+    void remove(ActorObjectExtended* actor);
+
+    ActorObjectExtended* find(Name name) const;
+    ActorObjectExtended* find(ActorRole role) const;
+
+private:
+    friend class ActorObjectExtended;
+
+    void rename(ActorObjectExtended* actor, Name oldName);
+    void changeRole(ActorObjectExtended* actor, ActorRole oldRole);
+
+    static void erase(std::vector<ActorObjectExtended*>& list, ActorObjectExtended* actor);
+
+    std::unordered_map<Name, std::vector<ActorObjectExtended*>> m_byName;
+    std::vector<ActorObjectExtended*> m_byRole[static_cast<int>(ActorRole::Count)];
+};
+
+} // namespace engine
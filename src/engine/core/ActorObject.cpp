@@ -3,6 +3,7 @@
  * @brief Implementation of ActorObject
  */
 #include "ActorObject.h"
+#include <algorithm>
 
 namespace engine {
 
@@ -11,28 +12,99 @@ ActorObject::ActorObject(const std::string& name)
 {
 }
 
+ActorObject::~ActorObject() {
+    attachTo(nullptr);
+    
+    // Children stay where they are
+    for (ActorObject* child : m_children) {
+        Transform2D global = child->getGlobalTransform();
+        child->m_parent = nullptr;
+        child->m_position = global.position;
+        child->m_rotation = global.rotation;
+        child->m_scale = global.scale;
+        child->m_transformDirty = false;
+        child->markTransformDirty();
+    }
+}
+
 void ActorObject::setPosition(float x, float y) {
     m_position.x = x;
     m_position.y = y;
+    markTransformDirty();
 }
 
 void ActorObject::setPosition(float x, float y, float z) {
     m_position.x = x;
     m_position.y = y;
     m_positionZ = z;
+    markTransformDirty();
 }
 
 void ActorObject::setPosition(const Vec2& pos) {
     m_position = pos;
+    markTransformDirty();
 }
 
 void ActorObject::setScale(float sx, float sy) {
     m_scale.x = sx;
     m_scale.y = sy;
+    markTransformDirty();
 }
 
 void ActorObject::setScale(const Vec2& scale) {
     m_scale = scale;
+    markTransformDirty();
+}
+
+// ============================================================================
+// HIERARCHY
+// ============================================================================
+
+bool ActorObject::attachTo(ActorObject* parent, bool keepGlobalTransform) {
+    if (parent == m_parent) return true;
+    for (ActorObject* p = parent; p; p = p->m_parent) {
+        if (p == this) return false;
+    }
+    
+    Transform2D global = getGlobalTransform();
+    
+    if (m_parent) {
+        auto& siblings = m_parent->m_children;
+        siblings.erase(std::remove(siblings.begin(), siblings.end(), this), siblings.end());
+    }
+    m_parent = parent;
+    if (m_parent) {
+        m_parent->m_children.push_back(this);
+    }
+    
+    if (keepGlobalTransform) {
+        Transform2D local = m_parent ? global.relativeTo(m_parent->getGlobalTransform()) : global;
+        m_position = local.position;
+        m_rotation = local.rotation;
+        m_scale = local.scale;
+    }
+    
+    // Force the subtree dirty even if this actor already was
+    m_transformDirty = false;
+    markTransformDirty();
+    return true;
+}
+
+void ActorObject::markTransformDirty() {
+    if (m_transformDirty) return;  // Descendants are dirty already
+    
+    m_transformDirty = true;
+    for (ActorObject* child : m_children) {
+        child->markTransformDirty();
+    }
+}
+
+void ActorObject::updateGlobalTransform() const {
+    m_globalTransform = m_parent
+        ? m_parent->getGlobalTransform() * getLocalTransform()
+        : getLocalTransform();
+    m_transformVersion++;
+    m_transformDirty = false;
 }
 
 void ActorObject::update(float deltaTime) {
@@ -10,7 +10,10 @@
 #pragma once
 
 #include "Object.h"
+#include "Transform2D.h"
 #include "Vec2.h"
+#include <cstdint>
+#include <vector>
 #include <SDL.h>
 
 namespace engine {
@@ -19,7 +22,7 @@ namespace engine {
  * @brief Base class for all game actors
  * 
  * Features:
- * - Transform (position, rotation, scale)
+ * - Transform (position, rotation, scale), relative to an optional parent
  * - Lifecycle hooks
  * - Component ownership (via ActorObjectExtended)
  * 
@@ -28,7 +31,7 @@ namespace engine {
 class ActorObject : public Object {
 public:
     ActorObject(const std::string& name);
-    virtual ~ActorObject() = default;
+    virtual ~ActorObject();
     
     // ========================================================================
     // TRANSFORM
@@ -43,7 +46,7 @@ public:
     float getZ() const { return m_positionZ; }
     void setZ(float z) { m_positionZ = z; }
     
-    void setRotation(float angle) { m_rotation = angle; }
+    void setRotation(float angle) { m_rotation = angle; markTransformDirty(); }
     float getRotation() const { return m_rotation; }
     
     void setScale(float sx, float sy);
@@ -57,10 +60,48 @@ public:
     void setVisible(bool visible) { m_visible = visible; }
     bool isVisible() const { return m_visible; }
     
-    // Global transform (compatibility - simplified without parent hierarchy)
-    Vec2 getGlobalPosition() const { return m_position; }
-    float getGlobalRotation() const { return m_rotation; }
-    Vec2 getGlobalScale() const { return m_scale; }
+    // ========================================================================
+    // HIERARCHY
+    // ========================================================================
+    
+    /**
+     * @brief Make this actor's transform relative to parent (nullptr = detach)
+     * @param keepGlobalTransform Adjust the local transform so the actor doesn't move
+     * @return false if parent is this actor or one of its descendants
+     * 
+     * Parents don't own their children; a destroyed parent leaves its
+     * children detached where they were.
+     */
+    bool attachTo(ActorObject* parent, bool keepGlobalTransform = false);
+    void detach(bool keepGlobalTransform = true) { attachTo(nullptr, keepGlobalTransform); }
+    
+    ActorObject* getParent() const { return m_parent; }
+    const std::vector<ActorObject*>& getChildren() const { return m_children; }
+    
+    // ========================================================================
+    // GLOBAL TRANSFORM
+    // ========================================================================
+    
+    /**
+     * Cached - recomputed only after this actor or an ancestor changed. 
+     * WorldContainer refreshes dirty actors once per frame, parents first.
+     */
+    Vec2 getGlobalPosition() const { return getGlobalTransform().position; }
+    float getGlobalRotation() const { return getGlobalTransform().rotation; }
+    Vec2 getGlobalScale() const { return getGlobalTransform().scale; }
+    
+    const Transform2D& getGlobalTransform() const {
+        if (m_transformDirty) updateGlobalTransform();
+        return m_globalTransform;
+    }
+    
+    /** @brief Changes whenever the global transform is recomputed (lets attachments cache against it) */
+    uint32_t getTransformVersion() const {
+        if (m_transformDirty) updateGlobalTransform();
+        return m_transformVersion;
+    }
+    
+    bool isTransformDirty() const { return m_transformDirty; }
     
     // ========================================================================
     // LIFECYCLE HOOKS
@@ -84,11 +125,26 @@ public:
     void render(SDL_Renderer* renderer) override;
     
 protected:
+    /** @brief Call after changing m_position, m_rotation or m_scale directly */
+    void markTransformDirty();
+    
     Vec2 m_position{0.0f, 0.0f};
     float m_positionZ = 0.0f;  // Z-component for 3D positioning
     float m_rotation = 0.0f;
     Vec2 m_scale{1.0f, 1.0f};
     bool m_visible = true;
+    
+private:
+    Transform2D getLocalTransform() const { return {m_position, m_rotation, m_scale}; }
+    void updateGlobalTransform() const;
+    
+    ActorObject* m_parent = nullptr;
+    std::vector<ActorObject*> m_children;
+    
+    // Dirty implies every descendant is dirty too, so a clean actor's cache is valid
+    mutable Transform2D m_globalTransform;
+    mutable uint32_t m_transformVersion = 0;
+    mutable bool m_transformDirty = true;
 };
 
 } // namespace engine
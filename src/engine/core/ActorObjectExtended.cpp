@@ -8,18 +8,80 @@ namespace engine {
 
 ActorObjectExtended::ActorObjectExtended(const std::string& name)
     : ActorObject(name)
+    , m_componentStorage(ComponentStorage::current())
 {
 }
 
+ActorObjectExtended::~ActorObjectExtended() {
+    if (m_tickManager) {
+        m_tickManager->removeActor(this);
+    }
+    if (m_actorIndex) {
+        m_actorIndex->remove(this);
+    }
+}
+
 void ActorObjectExtended::update(float deltaTime) {
     // Call base class update
     ActorObject::update(deltaTime);
     
-    // Update all enabled components
+    // Outside a container nobody else ticks our components
     for (auto& comp : m_components) {
-        if (comp->isEnabled()) {
-            comp->update(deltaTime);
+        if (comp->isEnabled() && comp->canEverTick() && !comp->isTickManaged()) {
+            comp->tickComponent(deltaTime);
+        }
+    }
+}
+
+void ActorObjectExtended::setCanEverTick(bool canTick) {
+    if (m_canEverTick == canTick) return;
+    
+    if (m_tickManager) m_tickManager->unlink(this);
+    m_canEverTick = canTick;
+    if (m_tickManager) m_tickManager->link(this);
+}
+
+void ActorObjectExtended::setRole(ActorRole role) {
+    if (m_role == role) return;
+    
+    ActorRole oldRole = m_role;
+    m_role = role;
+    if (m_actorIndex) m_actorIndex->changeRole(this, oldRole);
+}
+
+void ActorObjectExtended::onNameChanged(Name oldName) {
+    if (m_actorIndex) m_actorIndex->rename(this, oldName);
+}
+
+void ActorObjectExtended::setComponentSlot(ComponentTypeId id, ActorComponent* component) {
+    if (id >= COMPONENT_MASK_BITS) {
+        auto it = std::find_if(m_overflowSlots.begin(), m_overflowSlots.end(),
+                               [id](const auto& slot) { return slot.first == id; });
+        if (it != m_overflowSlots.end()) {
+            if (component) {
+                it->second = component;
+            } else {
+                m_overflowSlots.erase(it);
+            }
+        } else if (component) {
+            m_overflowSlots.emplace_back(id, component);
+        }
+        return;
+    }
+    
+    // Same type added twice: the latest one wins, as with the old type map
+    ComponentMask bit = ComponentMask(1) << id;
+    auto slot = m_componentSlots.begin() + detail::popCount(m_componentMask & (bit - 1));
+    if (m_componentMask & bit) {
+        if (component) {
+            *slot = component;
+        } else {
+            m_componentSlots.erase(slot);
+            m_componentMask &= ~bit;
         }
+    } else if (component) {
+        m_componentSlots.insert(slot, component);
+        m_componentMask |= bit;
     }
 }
 
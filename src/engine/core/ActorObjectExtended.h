@@ -9,10 +9,15 @@
 
 #include "ActorObject.h"
 #include "ActorComponent.h"
+#include "ActorIndex.h"
+#include "ComponentPool.h"
+#include "ComponentTypeId.h"
+#include "TickManager.h"
+#include <algorithm>
 #include <vector>
 #include <memory>
-#include <typeindex>
-#include <unordered_map>
+#include <type_traits>
+#include <utility>
 
 namespace engine {
 
@@ -28,11 +33,35 @@ namespace engine {
  * auto* sprite = actor->addComponent<SpriteComponent>();
  * sprite->setTexture(myTexture);
  * @endcode
+ * 
+ * Actors constructed inside a ComponentStorage::Scope (see
+ * WorldContainer::createActor) place their components in the scene's
+ * per-type pools instead of separate heap allocations. If the scene has
+ * an arena (WorldContainer::enableSceneArena) the actor itself is
+ * allocated from it too.
  */
 class ActorObjectExtended : public ActorObject {
 public:
     ActorObjectExtended(const std::string& name);
-    virtual ~ActorObjectExtended() = default;
+    virtual ~ActorObjectExtended();
+    
+    // Arena when constructed inside a Scope whose storage has one, heap otherwise
+    static void* operator new(size_t size) {
+        return MemoryArena::allocateObject(size, ComponentStorage::currentArena());
+    }
+    static void operator delete(void* ptr) {
+        MemoryArena::deallocateObject(ptr);
+    }
+    
+    /** @brief True if T has its own update() (false = inherits the empty base one) */
+    template<typename T>
+    static constexpr bool overridesUpdate() {
+        if constexpr (std::is_base_of_v<ActorObjectExtended, T>) {
+            return !std::is_same_v<decltype(&T::update), void (ActorObjectExtended::*)(float)>;
+        } else {
+            return !std::is_same_v<decltype(&T::update), void (ActorComponent::*)(float)>;
+        }
+    }
     
     // ========================================================================
     // COMPONENT MANAGEMENT
@@ -46,14 +75,22 @@ public:
      */
     template<typename T, typename... Args>
     T* addComponent(Args&&... args) {
-        auto component = std::make_unique<T>(std::forward<Args>(args)...);
+        ComponentPtr component = m_componentStorage
+            ? m_componentStorage->create<T>(std::forward<Args>(args)...)
+            : ComponentPtr(new T(std::forward<Args>(args)...));
         component->setOwner(this);
+        if constexpr (!overridesUpdate<T>()) {
+            component->setCanEverTick(false);
+        }
         component->initialize();
         
-        T* ptr = component.get();
+        T* ptr = static_cast<T*>(component.get());
         m_components.push_back(std::move(component));
-        m_componentMap[std::type_index(typeid(T))] = ptr;
+        setComponentSlot(componentTypeId<T>(), ptr);
         
+        if (m_tickManager) {
+            m_tickManager->addComponent(ptr);
+        }
         return ptr;
     }
     
@@ -64,30 +101,41 @@ public:
      */
     template<typename T>
     T* getComponent() {
-        auto it = m_componentMap.find(std::type_index(typeid(T)));
-        if (it != m_componentMap.end()) {
-            return static_cast<T*>(it->second);
+        return static_cast<T*>(findComponent(componentTypeId<T>()));
+    }
+    
+    /** @brief True if the actor has a component of every type in Ts */
+    template<typename... Ts>
+    bool hasComponents() const {
+        if (componentMaskComplete<Ts...>()) {
+            ComponentMask mask = componentMask<Ts...>();
+            return (m_componentMask & mask) == mask;
         }
-        return nullptr;
+        return (findComponent(componentTypeId<Ts>()) && ...);
     }
     
+    /** @brief One bit per component type the actor has (see ComponentTypeId.h) */
+    ComponentMask getComponentMask() const { return m_componentMask; }
+    
     /**
      * @brief Remove a component by type
      * @tparam T Component type
      */
     template<typename T>
     void removeComponent() {
-        auto it = m_componentMap.find(std::type_index(typeid(T)));
-        if (it != m_componentMap.end()) {
-            ActorComponent* comp = it->second;
+        ComponentTypeId id = componentTypeId<T>();
+        if (ActorComponent* comp = findComponent(id)) {
             comp->shutdown();
+            if (m_tickManager) {
+                m_tickManager->removeComponent(comp);
+            }
             
             m_components.erase(
                 std::remove_if(m_components.begin(), m_components.end(),
                     [comp](const auto& c) { return c.get() == comp; }),
                 m_components.end());
             
-            m_componentMap.erase(it);
+            setComponentSlot(id, nullptr);
         }
     }
     
@@ -95,10 +143,17 @@ public:
      * @brief Get all components
      * @return Vector of all components
      */
-    const std::vector<std::unique_ptr<ActorComponent>>& getComponents() const {
+    const std::vector<ComponentPtr>& getComponents() const {
         return m_components;
     }
     
+    /**
+     * @brief Pools for components added from now on (nullptr = heap)
+     * Components already added stay where they are.
+     */
+    void setComponentStorage(std::shared_ptr<ComponentStorage> storage) { m_componentStorage = std::move(storage); }
+    ComponentStorage* getComponentStorage() const { return m_componentStorage.get(); }
+    
     // ========================================================================
     // LIFECYCLE (Calls components)
     // ========================================================================
@@ -110,10 +165,74 @@ public:
     void setRenderOrder(int order) { m_renderOrder = order; }
     int getRenderOrder() const { return m_renderOrder; }
     
+    // ========================================================================
+    // TICKING
+    // ========================================================================
+    
+    /**
+     * @brief Whether the container calls update() on this actor
+     * 
+     * Components tick on their own (see ActorComponent::setTickGroup), so
+     * actors without own update() logic don't need to. createActor() clears
+     * this for types that don't override update().
+     */
+    bool canEverTick() const { return m_canEverTick; }
+    void setCanEverTick(bool canTick);
+    
+    /** @brief Container tick lists this actor is registered with (null = ticks its components itself) */
+    TickManager* getTickManager() const { return m_tickManager; }
+    
+    // ========================================================================
+    // ROLE
+    // ========================================================================
+    
+    /** @brief What this actor is to its scene (see WorldContainer::findActor(ActorRole)) */
+    ActorRole getRole() const { return m_role; }
+    void setRole(ActorRole role);
+    
+protected:
+    void onNameChanged(Name oldName) override;
+    
 private:
-    std::vector<std::unique_ptr<ActorComponent>> m_components;
-    std::unordered_map<std::type_index, ActorComponent*> m_componentMap;
+    friend class TickManager;
+    friend class ActorIndex;
+    friend class WorldContainer;
+    
+    /**
+     * @brief Component registered for a type ID
+     * IDs with a mask bit index m_componentSlots by the number of lower
+     * bits set; the rest are searched in m_overflowSlots.
+     */
+    ActorComponent* findComponent(ComponentTypeId id) const {
+        if (id < COMPONENT_MASK_BITS) {
+            ComponentMask bit = ComponentMask(1) << id;
+            if (!(m_componentMask & bit)) return nullptr;
+            return m_componentSlots[detail::popCount(m_componentMask & (bit - 1))];
+        }
+        for (const auto& slot : m_overflowSlots) {
+            if (slot.first == id) return slot.second;
+        }
+        return nullptr;
+    }
+    
+    /** @brief Register (or with nullptr, clear) the component for a type ID */
+    void setComponentSlot(ComponentTypeId id, ActorComponent* component);
+    
+    // Declared first so the pools outlive the components returned to them
+    std::shared_ptr<ComponentStorage> m_componentStorage;
+    std::vector<ComponentPtr> m_components;
+    ComponentMask m_componentMask = 0;
+    std::vector<ActorComponent*> m_componentSlots;  // One per mask bit, in type ID order
+    std::vector<std::pair<ComponentTypeId, ActorComponent*>> m_overflowSlots;  // IDs without a bit
     int m_renderOrder = 0;  // Higher values render on top
+    
+    bool m_canEverTick = true;
+    TickManager* m_tickManager = nullptr;
+    size_t m_tickIndex = SIZE_MAX;  // Position in the manager's actor list
+    
+    ActorRole m_role = ActorRole::None;
+    ActorIndex* m_actorIndex = nullptr;  // Container index this actor is listed in
+    size_t m_containerIndex = SIZE_MAX;  // Position in WorldContainer::getActors()
 };
 
 } // namespace engine
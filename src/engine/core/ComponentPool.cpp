@@ -0,0 +1,42 @@
+/**
+ * @file ComponentPool.cpp
+ * @brief ComponentStorage construction scope
+ */
+#include "ComponentPool.h"
+
+namespace engine {
+
+namespace {
+thread_local ComponentStorage* t_currentStorage = nullptr;
+}
+
+ComponentStorage::ComponentStorage(MemoryArena* arena)
+    : m_arena(arena)
+{
+    if (m_arena) m_arena->retain();
+}
+
+ComponentStorage::~ComponentStorage() {
+    m_pools.clear();
+    if (m_arena) m_arena->release();
+}
+
+ComponentStorage::Scope::Scope(ComponentStorage* storage)
+    : m_previous(t_currentStorage)
+{
+    t_currentStorage = storage;
+}
+
+ComponentStorage::Scope::~Scope() {
+    t_currentStorage = m_previous;
+}
+
+std::shared_ptr<ComponentStorage> ComponentStorage::current() {
+    return t_currentStorage ? t_currentStorage->shared_from_this() : nullptr;
+}
+
+MemoryArena* ComponentStorage::currentArena() {
+    return t_currentStorage ? t_currentStorage->m_arena : nullptr;
+}
+
+} // namespace engine
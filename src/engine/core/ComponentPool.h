@@ -0,0 +1,271 @@
+/**
+ * @file ComponentPool.h
+ * @brief Per-type component pools owned by a Scene
+ *
+ * Components normally get one heap allocation each. With pools enabled
+ * (WorldContainer::enableComponentPools) every component type lives in
+ * chunks of CHUNK_SIZE slots, so systems can walk e.g. all SpriteComponents
+ * in memory order. Addresses never move - actors keep plain pointers.
+ * With a scene arena the chunks themselves come from the MemoryArena.
+ */
+#pragma once
+
+#include "ActorComponent.h"
+#include "ComponentTypeId.h"
+#include "MemoryArena.h"
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace engine {
+
+class ComponentPoolBase;
+
+/**
+ * @brief Deleter for components - returns pooled ones to their pool
+ * A null pool means the component was heap allocated.
+ */
+struct ComponentDeleter {
+    ComponentPoolBase* pool = nullptr;
+    uint32_t index = 0;
+
+    void operator()(ActorComponent* component) const;
+};
+
+using ComponentPtr = std::unique_ptr<ActorComponent, ComponentDeleter>;
+
+/**
+ * @brief Stable reference to a pooled component
+ *
+ * Stays valid while the component lives; ComponentPool::get() returns
+ * nullptr once it is destroyed, even if the slot has been reused.
+ */
+template<typename T>
+struct ComponentHandle {
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = 0;
+
+    bool isNull() const { return index == UINT32_MAX; }
+};
+
+/**
+ * @brief Type-erased pool interface (see ComponentPool<T>)
+ */
+class ComponentPoolBase {
+public:
+    virtual ~ComponentPoolBase() = default;
+
+    /** @brief Destroy the component in slot index and free the slot */
+    virtual void release(uint32_t index) = 0;
+
+    /** @brief Live components */
+    virtual size_t size() const = 0;
+
+    /** @brief Allocated slots (live + free) */
+    virtual size_t capacity() const = 0;
+};
+
+/**
+ * @brief Chunked storage for one component type
+ *
+ * Slots are reused through a free list; each reuse bumps the slot's
+ * generation so old handles stop resolving.
+ *
+ * @par Thread Safety
+ * None - create/release from the game thread.
+ */
+template<typename T>
+class ComponentPool : public ComponentPoolBase {
+public:
+    static constexpr uint32_t CHUNK_SIZE = 64;
+
+    /** @param arena Allocate chunks here (nullptr = heap); must outlive the pool */
+    explicit ComponentPool(MemoryArena* arena = nullptr) : m_arena(arena) {}
+    ComponentPool(const ComponentPool&) = delete;
+    ComponentPool& operator=(const ComponentPool&) = delete;
+
+    ~ComponentPool() override {
+        for (uint32_t i = 0; i < m_alive.size(); i++) {
+            if (m_alive[i]) slot(i)->~T();
+        }
+        if (!m_arena) {
+            for (Chunk* chunk : m_chunks) delete chunk;
+        }
+    }
+
+    /** @brief Construct a component in a free slot */
+    template<typename... Args>
+    ComponentPtr create(Args&&... args) {
+        uint32_t index = acquireSlot();
+        T* component = new (slot(index)) T(std::forward<Args>(args)...);
+        m_alive[index] = 1;
+        m_size++;
+        return ComponentPtr(component, ComponentDeleter{this, index});
+    }
+
+    void release(uint32_t index) override {
+        if (index >= m_alive.size() || !m_alive[index]) return;
+
+        slot(index)->~T();
+        m_alive[index] = 0;
+        m_generations[index]++;
+        m_free.push_back(index);
+        m_size--;
+    }
+
+    size_t size() const override { return m_size; }
+    size_t capacity() const override { return m_alive.size(); }
+
+    /** @brief Handle for a component created by this pool (null handle otherwise) */
+    ComponentHandle<T> getHandle(const T* component) const {
+        for (uint32_t c = 0; c < m_chunks.size(); c++) {
+            const T* first = reinterpret_cast<const T*>(m_chunks[c]->storage);
+            if (component >= first && component < first + CHUNK_SIZE) {
+                uint32_t index = c * CHUNK_SIZE + static_cast<uint32_t>(component - first);
+                if (m_alive[index]) return {index, m_generations[index]};
+            }
+        }
+        return {};
+    }
+
+    /** @brief Component behind a handle, nullptr if it has been destroyed */
+    T* get(ComponentHandle<T> handle) const {
+        if (handle.index >= m_alive.size()) return nullptr;
+        if (!m_alive[handle.index] || m_generations[handle.index] != handle.generation) return nullptr;
+        return slot(handle.index);
+    }
+
+    /** @brief Call fn(T&) for every live component, in slot order */
+    template<typename Fn>
+    void forEach(Fn&& fn) const {
+        for (uint32_t i = 0; i < m_alive.size(); i++) {
+            if (m_alive[i]) fn(*slot(i));
+        }
+    }
+
+private:
+    struct Chunk {
+        alignas(T) unsigned char storage[sizeof(T) * CHUNK_SIZE];
+    };
+
+    T* slot(uint32_t index) const {
+        return reinterpret_cast<T*>(m_chunks[index / CHUNK_SIZE]->storage) + index % CHUNK_SIZE;
+    }
+
+    uint32_t acquireSlot() {
+        if (!m_free.empty()) {
+            uint32_t index = m_free.back();
+            m_free.pop_back();
+            return index;
+        }
+
+        uint32_t index = static_cast<uint32_t>(m_alive.size());
+        if (index % CHUNK_SIZE == 0) {
+            m_chunks.push_back(m_arena
+                ? new (m_arena->allocate(sizeof(Chunk), alignof(Chunk))) Chunk
+                : new Chunk);
+        }
+        m_alive.push_back(0);
+        m_generations.push_back(0);
+        return index;
+    }
+
+    MemoryArena* m_arena;
+    std::vector<Chunk*> m_chunks;   // Owned unless they live in m_arena
+    std::vector<uint8_t> m_alive;
+    std::vector<uint32_t> m_generations;
+    std::vector<uint32_t> m_free;
+    size_t m_size = 0;
+};
+
+/**
+ * @brief One pool per component type - owned by a Scene, shared with its actors
+ *
+ * Actors hold a shared_ptr, so pooled components stay valid if an actor
+ * outlives the scene that created it.
+ *
+ * With an arena (see MemoryArena) the storage keeps it alive, and actors
+ * constructed inside a Scope are allocated from it as well.
+ *
+ * Actors pick up the storage while they are constructed:
+ * @code
+ * {
+ *     ComponentStorage::Scope scope(storage);
+ *     auto actor = std::make_unique<NPCActor>(name, sprite);  // components go to the pools
+ * }
+ * @endcode
+ */
+class ComponentStorage : public std::enable_shared_from_this<ComponentStorage> {
+public:
+    /** @param arena Scene arena for pool chunks and actors (retained), nullptr = heap */
+    explicit ComponentStorage(MemoryArena* arena = nullptr);
+    ~ComponentStorage();
+    ComponentStorage(const ComponentStorage&) = delete;
+    ComponentStorage& operator=(const ComponentStorage&) = delete;
+
+    template<typename T, typename... Args>
+    ComponentPtr create(Args&&... args) {
+        return getOrCreatePool<T>().create(std::forward<Args>(args)...);
+    }
+
+    /** @brief Pool for T, nullptr if no T was ever created here */
+    template<typename T>
+    ComponentPool<T>* getPool() const {
+        ComponentTypeId id = componentTypeId<T>();
+        return id < m_pools.size() ? static_cast<ComponentPool<T>*>(m_pools[id].get()) : nullptr;
+    }
+
+    size_t getPoolCount() const { return m_poolCount; }
+
+    MemoryArena* getArena() const { return m_arena; }
+
+    /**
+     * @brief Makes storage the current one for ActorObjectExtended constructors
+     * Scopes nest; the previous storage comes back on destruction.
+     */
+    class Scope {
+    public:
+        explicit Scope(ComponentStorage* storage);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ComponentStorage* m_previous;
+    };
+
+    /** @brief Storage of the innermost Scope on this thread (may be null) */
+    static std::shared_ptr<ComponentStorage> current();
+
+    /** @brief Arena of the innermost Scope's storage (nullptr = allocate on the heap) */
+    static MemoryArena* currentArena();
+
+private:
+    template<typename T>
+    ComponentPool<T>& getOrCreatePool() {
+        ComponentTypeId id = componentTypeId<T>();
+        if (id >= m_pools.size()) m_pools.resize(id + 1);
+        auto& pool = m_pools[id];
+        if (!pool) {
+            pool = std::make_unique<ComponentPool<T>>(m_arena);
+            m_poolCount++;
+        }
+        return *static_cast<ComponentPool<T>*>(pool.get());
+    }
+
+    MemoryArena* m_arena;                                     // Released after the pools
+    std::vector<std::unique_ptr<ComponentPoolBase>> m_pools;  // Indexed by ComponentTypeId
+    size_t m_poolCount = 0;
+};
+
+inline void ComponentDeleter::operator()(ActorComponent* component) const {
+    if (pool) {
+        pool->release(index);
+    } else {
+        delete component;
+    }
+}
+
+} // namespace engine
@@ -0,0 +1,70 @@
+/**
+ * @file ComponentTypeId.h
+ * @brief Dense per-type component IDs and masks
+ *
+ * Every component type gets a small integer the first time it is used,
+ * counting up from 0. IDs below COMPONENT_MASK_BITS map to one bit in a
+ * ComponentMask, so "does this actor have A and B" is a single AND.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace engine {
+
+using ComponentTypeId = uint32_t;
+using ComponentMask = uint64_t;
+
+/** @brief Component types that fit in a ComponentMask - later types still work, just without a bit */
+constexpr ComponentTypeId COMPONENT_MASK_BITS = 64;
+
+namespace detail {
+
+inline ComponentTypeId nextComponentTypeId() {
+    static std::atomic<ComponentTypeId> next{0};
+    return next++;
+}
+
+inline uint32_t popCount(ComponentMask mask) {
+#if defined(_MSC_VER)
+    return static_cast<uint32_t>(__popcnt64(mask));
+#else
+    return static_cast<uint32_t>(__builtin_popcountll(mask));
+#endif
+}
+
+} // namespace detail
+
+/**
+ * @brief ID of component type T, stable for the lifetime of the process
+ * IDs depend on first-use order, so don't save them.
+ */
+template<typename T>
+ComponentTypeId componentTypeId() {
+    static const ComponentTypeId id = detail::nextComponentTypeId();
+    return id;
+}
+
+/** @brief Bit for one type ID (0 if the ID has no bit) */
+inline ComponentMask componentBit(ComponentTypeId id) {
+    return id < COMPONENT_MASK_BITS ? ComponentMask(1) << id : 0;
+}
+
+/** @brief True if all of Ts have a bit, i.e. componentMask<Ts...>() is a complete test */
+template<typename... Ts>
+bool componentMaskComplete() {
+    return ((componentTypeId<Ts>() < COMPONENT_MASK_BITS) && ...);
+}
+
+/** @brief Mask with the bits of all Ts */
+template<typename... Ts>
+ComponentMask componentMask() {
+    return (componentBit(componentTypeId<Ts>()) | ... | ComponentMask(0));
+}
+
+} // namespace engine
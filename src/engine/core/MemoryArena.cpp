@@ -0,0 +1,56 @@
+/**
+ * @file MemoryArena.cpp
+ * @brief Scene arena implementation
+ */
+#include "MemoryArena.h"
+#include <new>
+
+namespace engine {
+
+MemoryArena* MemoryArena::create(size_t initialBlockSize) {
+    return new MemoryArena(initialBlockSize);
+}
+
+MemoryArena::MemoryArena(size_t initialBlockSize)
+    : m_resource(initialBlockSize > 0 ? initialBlockSize : DEFAULT_BLOCK_SIZE)
+{
+}
+
+void* MemoryArena::allocate(size_t size, size_t alignment) {
+    m_bytesAllocated += size;
+    m_allocationCount++;
+    return m_resource.allocate(size, alignment);
+}
+
+void MemoryArena::release() {
+    if (--m_refCount == 0) {
+        delete this;  // ~monotonic_buffer_resource frees all blocks
+    }
+}
+
+void* MemoryArena::allocateObject(size_t size, MemoryArena* arena) {
+    size_t total = sizeof(AllocHeader) + size;
+    void* memory = nullptr;
+    if (arena) {
+        memory = arena->allocate(total, alignof(AllocHeader));
+        arena->retain();
+    } else {
+        memory = ::operator new(total);
+    }
+
+    auto* header = new (memory) AllocHeader{arena};
+    return header + 1;
+}
+
+void MemoryArena::deallocateObject(void* ptr) {
+    if (!ptr) return;
+
+    auto* header = static_cast<AllocHeader*>(ptr) - 1;
+    if (MemoryArena* arena = header->arena) {
+        arena->release();  // Memory goes back with the arena
+    } else {
+        ::operator delete(header);
+    }
+}
+
+} // namespace engine
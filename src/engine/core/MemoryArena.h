@@ -0,0 +1,72 @@
+/**
+ * @file MemoryArena.h
+ * @brief Scene-lifetime bump allocator
+ *
+ * Scenes that enable an arena (WorldContainer::enableSceneArena) place
+ * their actors and component pool chunks here instead of separate heap
+ * allocations. Nothing is freed one at a time; all blocks go back to the
+ * heap at once when the last user releases the arena.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace engine {
+
+/**
+ * @brief Monotonic arena with a reference count
+ *
+ * The creator holds one reference; every live allocation that must
+ * outlive the creator (actors, ComponentStorage) holds another. The
+ * arena deletes itself - and frees every block - when the count
+ * reaches zero.
+ *
+ * @par Thread Safety
+ * None - allocate and release from the game thread.
+ */
+class MemoryArena {
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    /** @brief New arena with a reference count of 1 */
+    static MemoryArena* create(size_t initialBlockSize = DEFAULT_BLOCK_SIZE);
+
+    MemoryArena(const MemoryArena&) = delete;
+    MemoryArena& operator=(const MemoryArena&) = delete;
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    void retain() { m_refCount++; }
+    void release();
+
+    /** @brief Bytes handed out so far (freed memory is never reused) */
+    size_t getBytesAllocated() const { return m_bytesAllocated; }
+    size_t getAllocationCount() const { return m_allocationCount; }
+
+    /**
+     * @brief Allocate an object of class T that may live in an arena
+     *
+     * For class-specific operator new: places an AllocHeader in front of
+     * the object that records the arena (or nullptr for the heap), so
+     * deallocateObject() knows where the memory came from. Arena
+     * allocations retain the arena until deallocated.
+     */
+    static void* allocateObject(size_t size, MemoryArena* arena);
+    static void deallocateObject(void* ptr);
+
+private:
+    struct alignas(std::max_align_t) AllocHeader {
+        MemoryArena* arena;
+    };
+
+    explicit MemoryArena(size_t initialBlockSize);
+    ~MemoryArena() = default;
+
+    std::pmr::monotonic_buffer_resource m_resource;
+    size_t m_refCount = 1;
+    size_t m_bytesAllocated = 0;
+    size_t m_allocationCount = 0;
+};
+
+} // namespace engine
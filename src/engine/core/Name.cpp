@@ -0,0 +1,39 @@
+/**
+ * @file Name.cpp
+ * @brief Name table
+ */
+#include "Name.h"
+#include <mutex>
+#include <unordered_set>
+
+namespace engine {
+
+namespace {
+
+// Set nodes don't move on rehash, so entries can be handed out as pointers
+const std::string* intern(const std::string& str) {
+    static std::mutex mutex;
+    static std::unordered_set<std::string> table;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return &*table.insert(str).first;
+}
+
+} // namespace
+
+Name::Name() {
+    static const std::string* empty = intern(std::string());
+    m_entry = empty;
+}
+
+Name::Name(const std::string& str)
+    : m_entry(intern(str))
+{
+}
+
+Name::Name(const char* str)
+    : m_entry(intern(str ? std::string(str) : std::string()))
+{
+}
+
+} // namespace engine
@@ -0,0 +1,50 @@
+/**
+ * @file Name.h
+ * @brief Interned object names (like FName in Unreal Engine)
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace engine {
+
+/**
+ * @brief Interned string - one shared copy per distinct name
+ *
+ * Comparing and hashing a Name is a pointer operation, so name lookups
+ * in hot paths don't touch the characters. Creating a Name from a string
+ * looks it up in a global table; keep Names around instead of building
+ * them every frame.
+ *
+ * @par Thread Safety
+ * Interning is thread-safe. Interned strings are never freed.
+ */
+class Name {
+public:
+    /** @brief The empty name */
+    Name();
+    Name(const std::string& str);
+    Name(const char* str);
+
+    const std::string& str() const { return *m_entry; }
+    bool isEmpty() const { return m_entry->empty(); }
+
+    bool operator==(const Name& other) const { return m_entry == other.m_entry; }
+    bool operator!=(const Name& other) const { return m_entry != other.m_entry; }
+
+    size_t hash() const { return std::hash<const std::string*>()(m_entry); }
+
+private:
+    const std::string* m_entry;
+};
+
+} // namespace engine
+
+namespace std {
+template<>
+struct hash<engine::Name> {
+    size_t operator()(const engine::Name& name) const { return name.hash(); }
+};
+} // namespace std
@@ -8,8 +8,18 @@ namespace engine {
 
 Object::Object(const std::string& name)
     : m_name(name)
+    , m_nameId(name)
     , m_active(true)
 {
 }
 
+void Object::setName(const std::string& name) {
+    Name oldName = m_nameId;
+    m_name = name;
+    m_nameId = Name(name);
+    if (m_nameId != oldName) {
+        onNameChanged(oldName);
+    }
+}
+
 } // namespace engine
@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include "Name.h"
 #include <string>
 #include <SDL.h>
 
@@ -32,7 +33,10 @@ public:
     // ========================================================================
     
     const std::string& getName() const { return m_name; }
-    void setName(const std::string& name) { m_name = name; }
+    void setName(const std::string& name);
+    
+    /** @brief Interned name - compare and hash this instead of getName() in hot paths */
+    Name getNameId() const { return m_nameId; }
     
     // ========================================================================
     // STATE
@@ -58,7 +62,11 @@ public:
     virtual void render(SDL_Renderer* renderer) = 0;
     
 protected:
+    /** @brief Called after setName() changed the name (e.g. to update name indices) */
+    virtual void onNameChanged(Name oldName) { (void)oldName; }
+    
     std::string m_name;
+    Name m_nameId;
     bool m_active = true;
 };
 
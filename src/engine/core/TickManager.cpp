@@ -0,0 +1,112 @@
+/**
+ * @file TickManager.cpp
+ * @brief Tick list implementation
+ */
+#include "TickManager.h"
+#include "ActorObjectExtended.h"
+
+namespace engine {
+
+void TickManager::addActor(ActorObjectExtended* actor) {
+    if (!actor || actor->m_tickManager == this) return;
+    if (actor->m_tickManager) actor->m_tickManager->removeActor(actor);
+
+    actor->m_tickManager = this;
+    link(actor);
+    for (const auto& component : actor->getComponents()) {
+        addComponent(component.get());
+    }
+}
+
+void TickManager::removeActor(ActorObjectExtended* actor) {
+    if (!actor || actor->m_tickManager != this) return;
+
+    for (const auto& component : actor->getComponents()) {
+        removeComponent(component.get());
+    }
+    unlink(actor);
+    actor->m_tickManager = nullptr;
+}
+
+void TickManager::addComponent(ActorComponent* component) {
+    if (!component || component->m_tickManager == this) return;
+    if (component->m_tickManager) component->m_tickManager->removeComponent(component);
+
+    component->m_tickManager = this;
+    link(component);
+}
+
+void TickManager::removeComponent(ActorComponent* component) {
+    if (!component || component->m_tickManager != this) return;
+
+    unlink(component);
+    component->m_tickManager = nullptr;
+}
+
+void TickManager::tick(TickGroup group, float deltaTime) {
+    auto& list = m_groups[static_cast<int>(group)];
+
+    // Index loop - update() may add or remove components
+    for (size_t i = 0; i < list.size(); i++) {
+        ActorComponent* component = list[i];
+        if (!component->isEnabled()) continue;
+
+        ActorObject* owner = component->getOwner();
+        if (owner && !owner->isActive()) continue;
+
+        component->tickComponent(deltaTime);
+    }
+}
+
+void TickManager::tickActors(float deltaTime) {
+    for (size_t i = 0; i < m_actors.size(); i++) {
+        ActorObjectExtended* actor = m_actors[i];
+        if (actor->isActive()) {
+            actor->update(deltaTime);
+        }
+    }
+}
+
+// ============================================================================
+// LIST MEMBERSHIP
+// ============================================================================
+
+void TickManager::link(ActorComponent* component) {
+    if (component->m_tickIndex != SIZE_MAX || !component->m_canEverTick) return;
+
+    auto& list = m_groups[static_cast<int>(component->m_tickGroup)];
+    component->m_tickIndex = list.size();
+    list.push_back(component);
+}
+
+void TickManager::unlink(ActorComponent* component) {
+    size_t index = component->m_tickIndex;
+    if (index == SIZE_MAX) return;
+
+    auto& list = m_groups[static_cast<int>(component->m_tickGroup)];
+    ActorComponent* last = list.back();
+    list[index] = last;
+    last->m_tickIndex = index;
+    list.pop_back();
+    component->m_tickIndex = SIZE_MAX;
+}
+
+void TickManager::link(ActorObjectExtended* actor) {
+    if (actor->m_tickIndex != SIZE_MAX || !actor->m_canEverTick) return;
+
+    actor->m_tickIndex = m_actors.size();
+    m_actors.push_back(actor);
+}
+
+void TickManager::unlink(ActorObjectExtended* actor) {
+    size_t index = actor->m_tickIndex;
+    if (index == SIZE_MAX) return;
+
+    ActorObjectExtended* last = m_actors.back();
+    m_actors[index] = last;
+    last->m_tickIndex = index;
+    m_actors.pop_back();
+    actor->m_tickIndex = SIZE_MAX;
+}
+
+} // namespace engine
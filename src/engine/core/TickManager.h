@@ -0,0 +1,65 @@
+/**
+ * @file TickManager.h
+ * @brief Dense per-group tick lists for a WorldContainer
+ */
+#pragma once
+
+#include "ActorComponent.h"
+#include <cstddef>
+#include <vector>
+
+namespace engine {
+
+class ActorObjectExtended;
+
+/**
+ * @brief Ticks components by TickGroup and actors that override update()
+ *
+ * Owned by WorldContainer and declared before its actors, so it outlives
+ * them. Actors added to the container are registered here together with
+ * their components; components that can't tick never enter a list, so
+ * idle components cost nothing per frame. Lists are unordered - removal
+ * swaps the last entry into the freed slot.
+ *
+ * Adding or removing while a list is ticking is allowed: entries added
+ * during a tick run in the same pass, an entry swapped into a removed
+ * slot waits until the next frame.
+ */
+class TickManager {
+public:
+    TickManager() = default;
+    TickManager(const TickManager&) = delete;
+    TickManager& operator=(const TickManager&) = delete;
+
+    /** @brief Register an actor and all its components */
+    void addActor(ActorObjectExtended* actor);
+    void removeActor(ActorObjectExtended* actor);
+
+    /** @brief Take over ticking a component (called for components added later) */
+    void addComponent(ActorComponent* component);
+    void removeComponent(ActorComponent* component);
+
+    /** @brief Tick every enabled component in group whose owner is active */
+    void tick(TickGroup group, float deltaTime);
+
+    /** @brief Call update() on every active ticking actor */
+    void tickActors(float deltaTime);
+
+    size_t getTickCount(TickGroup group) const { return m_groups[static_cast<int>(group)].size(); }
+    size_t getActorTickCount() const { return m_actors.size(); }
+
+private:
+    friend class ActorComponent;
+    friend class ActorObjectExtended;
+
+    // List membership only, following canEverTick and the tick group
+    void link(ActorComponent* component);
+    void unlink(ActorComponent* component);
+    void link(ActorObjectExtended* actor);
+    void unlink(ActorObjectExtended* actor);
+
+    std::vector<ActorComponent*> m_groups[static_cast<int>(TickGroup::Count)];
+    std::vector<ActorObjectExtended*> m_actors;
+};
+
+} // namespace engine
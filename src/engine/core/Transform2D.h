@@ -0,0 +1,48 @@
+/**
+ * @file Transform2D.h
+ * @brief Position, rotation and scale combined for parent/child transforms
+ */
+#pragma once
+
+#include "Vec2.h"
+
+namespace engine {
+
+/**
+ * @brief 2D transform - rotation in degrees, like ActorObject::setRotation
+ */
+struct Transform2D {
+    Vec2 position{0.0f, 0.0f};
+    float rotation = 0.0f;
+    Vec2 scale{1.0f, 1.0f};
+
+    /** @brief World transform of a child whose local transform is local */
+    Transform2D operator*(const Transform2D& local) const {
+        Transform2D world;
+        Vec2 scaled(local.position.x * scale.x, local.position.y * scale.y);
+        world.position = position + scaled.rotated(rotation * DEG_TO_RAD);
+        world.rotation = rotation + local.rotation;
+        world.scale = Vec2(scale.x * local.scale.x, scale.y * local.scale.y);
+        return world;
+    }
+
+    /** @brief Local transform that gives this world transform under parent */
+    Transform2D relativeTo(const Transform2D& parent) const {
+        Transform2D local;
+        Vec2 offset = (position - parent.position).rotated(-parent.rotation * DEG_TO_RAD);
+        local.position = Vec2(safeDivide(offset.x, parent.scale.x), safeDivide(offset.y, parent.scale.y));
+        local.rotation = rotation - parent.rotation;
+        local.scale = Vec2(safeDivide(scale.x, parent.scale.x), safeDivide(scale.y, parent.scale.y));
+        return local;
+    }
+
+private:
+    static constexpr float DEG_TO_RAD = 3.14159265358979f / 180.0f;
+
+    // A zero parent scale collapses the child; keep the value instead of producing inf
+    static float safeDivide(float value, float divisor) {
+        return divisor != 0.0f ? value / divisor : value;
+    }
+};
+
+} // namespace engine
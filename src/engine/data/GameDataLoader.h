@@ -212,7 +212,7 @@ public:
                     std::cout << "[DEBUG]   Actor: " << actor->getName() << std::endl;
                 }
                 
-                auto* bgActor = scene->findActor("Background");
+                auto* bgActor = scene->findActor(engine::ActorRole::Background);
                 if (bgActor) {
                     std::cout << "[DEBUG] Found Background actor" << std::endl;
                     auto* spriteComp = bgActor->getComponent<engine::SpriteComponent>();
@@ -55,6 +55,10 @@ public:
     bool isPhysicsDebugEnabled() const { return m_physicsDebug; }
     void setPhysicsDebug(bool enabled) { m_physicsDebug = enabled; }
     
+    /** @brief Box2D solver threads (0 = auto, 1 = single-threaded), applied when a scene enables physics */
+    int getPhysicsWorkerCount() const { return m_physicsWorkerCount; }
+    void setPhysicsWorkerCount(int count) { m_physicsWorkerCount = count; }
+    
     // ========================================================================
     // HELPER
     // ========================================================================
@@ -78,6 +82,7 @@ private:
     float m_walkSpeed = 200.0f;
     float m_runSpeed = 350.0f;
     bool m_physicsDebug = true;
+    int m_physicsWorkerCount = 0;
 };
 
 } // namespace engine
@@ -5,6 +5,8 @@
 #include "TileMapLayer.h"
 #include "world/Camera2D.h"
 #include <algorithm>
+#include <cmath>
+#include <iostream>
 
 namespace engine {
 
@@ -29,6 +31,28 @@ TileMapLayer::TileMapLayer(const std::string& name, int width, int height, int t
     resize(width, height);
 }
 
+TileMapLayer::~TileMapLayer() {
+    destroyCollision();
+}
+
+void TileMapLayer::update(float deltaTime) {
+    VisualActor::update(deltaTime);
+    
+    // Apply setSolid() edits made since the last frame
+    if (m_collisionWorld && m_anyShapesDirty) {
+        bakeCollision();
+    }
+}
+
+void TileMapLayer::setTileSize(int size) {
+    m_tileSize = size;
+    
+    // Merged rects are in grid units, but built shapes are sized in pixels
+    for (auto& chunk : m_chunks) {
+        markChunkDirty(chunk);
+    }
+}
+
 // ═══════════════════════════════════════════════════════════════════════════
 // GRID
 // ═══════════════════════════════════════════════════════════════════════════
@@ -38,6 +62,7 @@ void TileMapLayer::resize(int width, int height) {
     m_height = height;
     m_tiles.resize(width * height, 0);
     m_solidTiles.resize(width * height, false);
+    resetCollisionChunks();
 }
 
 int TileMapLayer::getTile(int x, int y) const {
@@ -69,7 +94,12 @@ bool TileMapLayer::isSolid(int x, int y) const {
 
 void TileMapLayer::setSolid(int x, int y, bool solid) {
     if (!isInBounds(x, y)) return;
+    if (m_solidTiles[y * m_width + x] == solid) return;
     m_solidTiles[y * m_width + x] = solid;
+    
+    int chunkX = x / COLLISION_CHUNK_SIZE;
+    int chunkY = y / COLLISION_CHUNK_SIZE;
+    markChunkDirty(m_chunks[chunkY * m_chunkColumns + chunkX]);
 }
 
 std::vector<SDL_Rect> TileMapLayer::getSolidTiles(const SDL_Rect& area) const {
@@ -104,6 +134,276 @@ std::vector<SDL_Rect> TileMapLayer::getSolidTiles(const SDL_Rect& area) const {
     return result;
 }
 
+float TileMapLayer::sweepBox(float minX, float minY, float maxX, float maxY, int axis, float delta) const {
+    if (delta == 0.0f || m_tileSize <= 0) return delta;
+    
+    // Tolerance in tiles, so a box resting exactly on a tile edge (up to
+    // float error) neither counts as overlapping it nor skips past it
+    constexpr float EDGE_EPSILON = 1e-3f;
+    
+    Vec2 origin = getGlobalPosition();
+    float tileSize = static_cast<float>(m_tileSize);
+    
+    // Work in "along" (the motion axis) and "across" coordinates
+    float alongMin = (axis == 0 ? minX - origin.x : minY - origin.y) / tileSize;
+    float alongMax = (axis == 0 ? maxX - origin.x : maxY - origin.y) / tileSize;
+    float acrossMin = (axis == 0 ? minY - origin.y : minX - origin.x) / tileSize;
+    float acrossMax = (axis == 0 ? maxY - origin.y : maxX - origin.x) / tileSize;
+    
+    int acrossLimit = axis == 0 ? m_height : m_width;
+    int alongLimit = axis == 0 ? m_width : m_height;
+    int acrossStart = std::max(0, static_cast<int>(std::floor(acrossMin + EDGE_EPSILON)));
+    int acrossEnd = std::min(acrossLimit, static_cast<int>(std::ceil(acrossMax - EDGE_EPSILON)));
+    if (acrossStart >= acrossEnd) return delta;
+    
+    auto lineBlocked = [&](int along) {
+        if (along < 0 || along >= alongLimit) return false;
+        for (int across = acrossStart; across < acrossEnd; across++) {
+            int x = axis == 0 ? along : across;
+            int y = axis == 0 ? across : along;
+            if (m_solidTiles[y * m_width + x]) return true;
+        }
+        return false;
+    };
+    
+    float step = delta / tileSize;
+    if (step > 0.0f) {
+        int first = static_cast<int>(std::ceil(alongMax - EDGE_EPSILON));
+        int last = static_cast<int>(std::ceil(alongMax + step - EDGE_EPSILON)) - 1;
+        first = std::max(first, 0);
+        last = std::min(last, alongLimit - 1);
+        for (int along = first; along <= last; along++) {
+            if (lineBlocked(along)) {
+                return std::max(0.0f, (along - alongMax) * tileSize);
+            }
+        }
+    } else {
+        int first = static_cast<int>(std::floor(alongMin + EDGE_EPSILON)) - 1;
+        int last = static_cast<int>(std::floor(alongMin + step + EDGE_EPSILON));
+        first = std::min(first, alongLimit - 1);
+        last = std::max(last, 0);
+        for (int along = first; along >= last; along--) {
+            if (lineBlocked(along)) {
+                return std::min(0.0f, (along + 1 - alongMin) * tileSize);
+            }
+        }
+    }
+    
+    return delta;
+}
+
+std::vector<SDL_Rect> TileMapLayer::getSolidRects(const SDL_Rect& area) const {
+    mergeDirtyChunks();
+    std::vector<SDL_Rect> result;
+    if (m_tileSize <= 0) return result;
+    
+    // Same tile range as getSolidTiles, then only the chunks it covers
+    int startX = std::max(0, area.x / m_tileSize);
+    int startY = std::max(0, area.y / m_tileSize);
+    int endX = std::min(m_width, (area.x + area.w) / m_tileSize + 1);
+    int endY = std::min(m_height, (area.y + area.h) / m_tileSize + 1);
+    if (startX >= endX || startY >= endY) return result;
+    
+    for (int cy = startY / COLLISION_CHUNK_SIZE; cy <= (endY - 1) / COLLISION_CHUNK_SIZE; cy++) {
+        for (int cx = startX / COLLISION_CHUNK_SIZE; cx <= (endX - 1) / COLLISION_CHUNK_SIZE; cx++) {
+            for (const SDL_Rect& rect : m_chunks[cy * m_chunkColumns + cx].rects) {
+                if (rect.x >= endX || rect.x + rect.w <= startX ||
+                    rect.y >= endY || rect.y + rect.h <= startY) {
+                    continue;
+                }
+                result.push_back({rect.x * m_tileSize, rect.y * m_tileSize,
+                                  rect.w * m_tileSize, rect.h * m_tileSize});
+            }
+        }
+    }
+    
+    return result;
+}
+
+std::vector<SDL_Rect> TileMapLayer::getCollisionRects() const {
+    mergeDirtyChunks();
+    std::vector<SDL_Rect> result;
+    result.reserve(getCollisionRectCount());
+    for (const auto& chunk : m_chunks) {
+        result.insert(result.end(), chunk.rects.begin(), chunk.rects.end());
+    }
+    return result;
+}
+
+int TileMapLayer::getCollisionRectCount() const {
+    mergeDirtyChunks();
+    size_t count = 0;
+    for (const auto& chunk : m_chunks) {
+        count += chunk.rects.size();
+    }
+    return static_cast<int>(count);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// COLLISION BAKING
+// ═══════════════════════════════════════════════════════════════════════════
+
+void TileMapLayer::resetCollisionChunks() {
+    for (auto& chunk : m_chunks) {
+        destroyChunkShapes(chunk);
+    }
+    
+    m_chunkColumns = (m_width + COLLISION_CHUNK_SIZE - 1) / COLLISION_CHUNK_SIZE;
+    m_chunkRows = (m_height + COLLISION_CHUNK_SIZE - 1) / COLLISION_CHUNK_SIZE;
+    m_chunks.assign(m_chunkColumns * m_chunkRows, CollisionChunk{});
+    m_anyChunkDirty = true;
+    m_anyShapesDirty = true;
+}
+
+void TileMapLayer::markChunkDirty(CollisionChunk& chunk) {
+    chunk.dirty = true;
+    chunk.shapesDirty = true;
+    m_anyChunkDirty = true;
+    m_anyShapesDirty = true;
+}
+
+void TileMapLayer::mergeDirtyChunks() const {
+    if (!m_anyChunkDirty) return;
+    
+    for (int cy = 0; cy < m_chunkRows; cy++) {
+        for (int cx = 0; cx < m_chunkColumns; cx++) {
+            if (m_chunks[cy * m_chunkColumns + cx].dirty) {
+                mergeChunk(cx, cy);
+            }
+        }
+    }
+    m_anyChunkDirty = false;
+}
+
+void TileMapLayer::mergeChunk(int chunkX, int chunkY) const {
+    CollisionChunk& chunk = m_chunks[chunkY * m_chunkColumns + chunkX];
+    chunk.rects.clear();
+    chunk.dirty = false;
+    
+    int x0 = chunkX * COLLISION_CHUNK_SIZE;
+    int y0 = chunkY * COLLISION_CHUNK_SIZE;
+    int w = std::min(m_width, x0 + COLLISION_CHUNK_SIZE) - x0;
+    int h = std::min(m_height, y0 + COLLISION_CHUNK_SIZE) - y0;
+    
+    // Tiles already covered by a rect, local to the chunk
+    std::vector<bool>& used = m_mergeScratch;
+    used.assign(w * h, false);
+    
+    auto isFree = [&](int x, int y) {
+        return !used[y * w + x] && m_solidTiles[(y0 + y) * m_width + (x0 + x)];
+    };
+    
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            if (!isFree(x, y)) continue;
+            
+            // Widest run on this row, then grow down while the whole run is free
+            int runEnd = x + 1;
+            while (runEnd < w && isFree(runEnd, y)) runEnd++;
+            
+            int rowEnd = y + 1;
+            for (; rowEnd < h; rowEnd++) {
+                bool rowFree = true;
+                for (int i = x; i < runEnd && rowFree; i++) {
+                    rowFree = isFree(i, rowEnd);
+                }
+                if (!rowFree) break;
+            }
+            
+            for (int j = y; j < rowEnd; j++) {
+                for (int i = x; i < runEnd; i++) {
+                    used[j * w + i] = true;
+                }
+            }
+            chunk.rects.push_back({x0 + x, y0 + y, runEnd - x, rowEnd - y});
+        }
+    }
+}
+
+void TileMapLayer::bakeCollision() {
+    // Rects may already have been merged by a const getter - the shapes
+    // flags still remember which chunks need new Box2D shapes
+    mergeDirtyChunks();
+    if (!m_collisionWorld || !m_anyShapesDirty) return;
+    
+    for (auto& chunk : m_chunks) {
+        if (chunk.shapesDirty) {
+            destroyChunkShapes(chunk);
+            createChunkShapes(chunk);
+            chunk.shapesDirty = false;
+        }
+    }
+    m_anyShapesDirty = false;
+}
+
+void TileMapLayer::buildCollision(physics::PhysicsWorld2D* world) {
+    if (!world || !world->isInitialized()) {
+        std::cerr << "[TileMapLayer] Cannot build collision - world not ready" << std::endl;
+        return;
+    }
+    
+    destroyCollision();
+    
+    Vec2 globalPos = getGlobalPosition();
+    physics::BodyDef2D def;
+    def.type = physics::BodyType2D::Static;
+    def.position = {globalPos.x, globalPos.y};
+    def.userData = this;
+    
+    m_collisionBody = world->createBody(def);
+    if (!b2Body_IsValid(m_collisionBody)) {
+        m_collisionBody = b2_nullBodyId;
+        return;
+    }
+    m_collisionWorld = world;
+    
+    bakeCollision();
+    std::cout << "[TileMapLayer] " << getName() << ": " << getCollisionRectCount()
+              << " colliders for " << m_width << "x" << m_height << " tiles" << std::endl;
+}
+
+void TileMapLayer::destroyCollision() {
+    if (!m_collisionWorld) return;
+    
+    // Destroying the body takes its shapes with it - the next body needs all of them again
+    for (auto& chunk : m_chunks) {
+        chunk.shapes.clear();
+        chunk.shapesDirty = true;
+    }
+    m_anyShapesDirty = true;
+    m_collisionWorld->destroyBody(m_collisionBody);
+    m_collisionBody = b2_nullBodyId;
+    m_collisionWorld = nullptr;
+}
+
+void TileMapLayer::setCollisionEnabled(bool enabled) {
+    if (m_collisionWorld) {
+        m_collisionWorld->setBodyEnabled(m_collisionBody, enabled);
+    }
+}
+
+void TileMapLayer::createChunkShapes(CollisionChunk& chunk) {
+    chunk.shapes.reserve(chunk.rects.size());
+    
+    for (const SDL_Rect& rect : chunk.rects) {
+        physics::ShapeDef2D def;
+        def.type = physics::ShapeType2D::Box;
+        def.size = {static_cast<float>(rect.w * m_tileSize), static_cast<float>(rect.h * m_tileSize)};
+        def.offset = {(rect.x + rect.w * 0.5f) * m_tileSize, (rect.y + rect.h * 0.5f) * m_tileSize};
+        def.userData = this;
+        chunk.shapes.push_back(m_collisionWorld->addShape(m_collisionBody, def));
+    }
+}
+
+void TileMapLayer::destroyChunkShapes(CollisionChunk& chunk) {
+    if (m_collisionWorld) {
+        for (b2ShapeId shapeId : chunk.shapes) {
+            m_collisionWorld->removeShape(shapeId);
+        }
+    }
+    chunk.shapes.clear();
+}
+
 // ═══════════════════════════════════════════════════════════════════════════
 // WORLD CONVERSION
 // ═══════════════════════════════════════════════════════════════════════════
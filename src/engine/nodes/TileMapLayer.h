@@ -7,6 +7,7 @@
 #pragma once
 
 #include "engine/actors/VisualActor.h"
+#include "engine/physics/box2d/PhysicsWorld2D.h"
 #include <vector>
 #include <SDL.h>
 
@@ -19,7 +20,13 @@ namespace engine {
  * - Grid of tile IDs
  * - Tileset texture with tile size
  * - Efficient rendering (only visible tiles)
- * - Collision tile marking
+ * - Collision tile marking, baked into merged rectangles
+ * 
+ * Solid tiles are greedily merged into rectangles per 32x32-tile chunk.
+ * setSolid() only marks its chunk dirty; the chunk is re-merged the next
+ * time collision is read or update() runs, and only its Box2D shapes are
+ * replaced. A large map ends up with a few hundred static boxes instead
+ * of one per tile.
  * 
  * Now inherits from VisualActor for better categorization
  */
@@ -28,8 +35,9 @@ public:
     TileMapLayer();
     explicit TileMapLayer(const std::string& name);
     TileMapLayer(const std::string& name, int width, int height, int tileSize);
-    virtual ~TileMapLayer() = default;
+    virtual ~TileMapLayer();
     
+    void update(float deltaTime) override;
     void render(SDL_Renderer* renderer) override;
     
     // ═══════════════════════════════════════════════════════════════════
@@ -40,7 +48,7 @@ public:
     void setTileset(SDL_Texture* tileset) { m_tileset = tileset; }
     
     int getTileSize() const { return m_tileSize; }
-    void setTileSize(int size) { m_tileSize = size; }
+    void setTileSize(int size);
     
     /** @brief Tiles per row in tileset texture */
     int getTilesetColumns() const { return m_tilesetColumns; }
@@ -78,9 +86,52 @@ public:
     /** @brief Mark tile as solid/non-solid */
     void setSolid(int x, int y, bool solid);
     
-    /** @brief Get all solid tiles in area */
+    /** @brief Get all solid tiles in area (one rect per tile) */
     std::vector<SDL_Rect> getSolidTiles(const SDL_Rect& area) const;
     
+    /**
+     * @brief Move a box along one axis until it touches a solid tile
+     *
+     * Scans the solid flags column by column (or row by row) along the
+     * motion, so fast movers can't tunnel. Tiles the box already overlaps
+     * are ignored, which lets an embedded box move out. Coordinates are
+     * world pixels; tiles outside the grid count as empty.
+     *
+     * @param axis 0 = x, 1 = y
+     * @return Allowed movement, same sign as delta and |result| <= |delta|
+     */
+    float sweepBox(float minX, float minY, float maxX, float maxY, int axis, float delta) const;
+    
+    /** @brief Get merged solid rectangles that touch area (same space as getSolidTiles) */
+    std::vector<SDL_Rect> getSolidRects(const SDL_Rect& area) const;
+    
+    /** @brief All merged solid rectangles in grid units */
+    std::vector<SDL_Rect> getCollisionRects() const;
+    
+    /** @brief Number of merged rectangles (= static fixtures when built) */
+    int getCollisionRectCount() const;
+    
+    /** @brief Re-merge dirty chunks and replace their shapes in the physics world */
+    void bakeCollision();
+    
+    /**
+     * @brief Create one static body with a box per merged rectangle
+     *
+     * Later setSolid() edits are applied in update() (or bakeCollision()).
+     */
+    void buildCollision(physics::PhysicsWorld2D* world);
+    
+    /** @brief Destroy the static body created by buildCollision() */
+    void destroyCollision();
+    
+    bool hasCollision() const { return m_collisionWorld != nullptr; }
+    
+    /** @brief Take the collision body out of the simulation without destroying it */
+    void setCollisionEnabled(bool enabled);
+    
+    /** @brief Chunk edge in tiles; merged rectangles never cross chunks */
+    static constexpr int COLLISION_CHUNK_SIZE = 32;
+    
     // ═══════════════════════════════════════════════════════════════════
     // WORLD CONVERSION
     // ═══════════════════════════════════════════════════════════════════
@@ -95,6 +146,20 @@ protected:
     SDL_Rect getTileSourceRect(int tileId) const;
     bool isInBounds(int x, int y) const;
     
+    struct CollisionChunk {
+        std::vector<SDL_Rect> rects;     // Grid units
+        std::vector<b2ShapeId> shapes;   // One per rect while collision is built
+        bool dirty = true;               // rects need re-merging
+        bool shapesDirty = true;         // shapes need rebuilding (cleared by bakeCollision only)
+    };
+    
+    void resetCollisionChunks();
+    void mergeChunk(int chunkX, int chunkY) const;
+    void mergeDirtyChunks() const;
+    void markChunkDirty(CollisionChunk& chunk);
+    void createChunkShapes(CollisionChunk& chunk);
+    void destroyChunkShapes(CollisionChunk& chunk);
+    
     SDL_Texture* m_tileset = nullptr;
     int m_tileSize = 16;
     int m_tilesetColumns = 16;
@@ -103,6 +168,17 @@ protected:
     int m_height = 0;
     std::vector<int> m_tiles;        // Tile IDs (0 = empty)
     std::vector<bool> m_solidTiles;  // Collision flags
+    
+    // Merged collision, chunks are re-merged lazily from const getters
+    mutable std::vector<CollisionChunk> m_chunks;
+    mutable std::vector<bool> m_mergeScratch;
+    mutable bool m_anyChunkDirty = true;
+    bool m_anyShapesDirty = true;    // Const getters merge but never touch shapes
+    int m_chunkColumns = 0;
+    int m_chunkRows = 0;
+    
+    physics::PhysicsWorld2D* m_collisionWorld = nullptr;
+    b2BodyId m_collisionBody = b2_nullBodyId;
 };
 
 } // namespace engine
@@ -0,0 +1,90 @@
+/**
+ * @file CollisionSystem.cpp
+ * @brief Implementation of CollisionSystem
+ */
+#include "CollisionSystem.h"
+#include "engine/components/CollisionComponent.h"
+
+namespace engine {
+
+CollisionSystem::CollisionSystem(int cellSize)
+    : m_grid(cellSize)
+{
+}
+
+void CollisionSystem::clear() {
+    m_grid.clear();
+    m_entries.clear();
+    m_active.clear();
+    m_pairs.clear();
+}
+
+void CollisionSystem::update(const std::vector<std::unique_ptr<ActorObjectExtended>>& actors) {
+    m_frame++;
+
+    gather(actors);
+    findPairs();
+    dispatch();
+}
+
+void CollisionSystem::gather(const std::vector<std::unique_ptr<ActorObjectExtended>>& actors) {
+    m_active.clear();
+
+    for (const auto& actor : actors) {
+        if (!actor || !actor->isActive()) continue;
+
+        auto* collision = actor->getComponent<CollisionComponent>();
+        if (!collision || !collision->isEnabled()) continue;
+
+        SDL_Rect bounds = collision->getWorldBounds();
+        Entry& entry = m_entries[collision];
+        if (entry.proxy == SpatialGrid::NULL_PROXY) {
+            entry.proxy = m_grid.createProxy(bounds, collision);
+        } else {
+            m_grid.moveProxy(entry.proxy, bounds);
+        }
+        entry.frame = m_frame;
+
+        m_active.emplace_back(collision, entry.proxy);
+    }
+
+    // Drop components that were removed, disabled or whose actor went inactive
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (it->second.frame != m_frame) {
+            m_grid.destroyProxy(it->second.proxy);
+            it = m_entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void CollisionSystem::findPairs() {
+    m_pairs.clear();
+
+    for (const auto& [collision, proxy] : m_active) {
+        m_candidates.clear();
+        m_grid.queryRect(m_grid.getBounds(proxy), m_candidates);
+
+        for (SpatialGrid::ProxyId other : m_candidates) {
+            // Each pair is seen from both sides - keep the one with the lower id
+            if (other <= proxy) continue;
+
+            auto* otherCollision = static_cast<CollisionComponent*>(m_grid.getUserData(other));
+            if (otherCollision->getOwner() == collision->getOwner()) continue;
+
+            if (collision->checkCollision(otherCollision)) {
+                m_pairs.push_back({collision, otherCollision});
+            }
+        }
+    }
+}
+
+void CollisionSystem::dispatch() {
+    for (const auto& pair : m_pairs) {
+        pair.a->notifyCollision(pair.b->getOwner());
+        pair.b->notifyCollision(pair.a->getOwner());
+    }
+}
+
+} // namespace engine
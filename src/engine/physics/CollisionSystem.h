@@ -0,0 +1,77 @@
+/**
+ * @file CollisionSystem.h
+ * @brief Scene-level batched collision for CollisionComponent
+ */
+#pragma once
+
+#include "SpatialGrid.h"
+#include "core/ActorObjectExtended.h"
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <cstdint>
+
+namespace engine {
+
+class CollisionComponent;
+
+/**
+ * @brief Resolves all CollisionComponent overlaps once per frame
+ *
+ * Owned by a WorldContainer (see enableCollisionSystem()). Each update:
+ * 1. Gathers every enabled CollisionComponent on active actors and moves
+ *    its proxy in a SpatialGrid (components that disappeared are dropped)
+ * 2. Builds unique overlap pairs in one broad phase pass
+ * 3. Runs CollisionComponent::checkCollision as narrow phase
+ * 4. Fires setOnCollision callbacks for both sides of every pair
+ *
+ * Callbacks run after detection is complete, so moving actors inside a
+ * callback doesn't affect other pairs this frame.
+ *
+ * @par Thread Safety
+ * Not thread-safe. Call from the main thread during scene update.
+ */
+class CollisionSystem {
+public:
+    struct CollisionPair {
+        CollisionComponent* a = nullptr;
+        CollisionComponent* b = nullptr;
+    };
+
+    explicit CollisionSystem(int cellSize = 64);
+    ~CollisionSystem() = default;
+
+    CollisionSystem(const CollisionSystem&) = delete;
+    CollisionSystem& operator=(const CollisionSystem&) = delete;
+
+    /** @brief Detect and dispatch collisions for all actors */
+    void update(const std::vector<std::unique_ptr<ActorObjectExtended>>& actors);
+
+    /** @brief Drop all tracked components */
+    void clear();
+
+    /** @brief Pairs found in the last update */
+    const std::vector<CollisionPair>& getPairs() const { return m_pairs; }
+
+    /** @brief Components tracked in the last update */
+    int getComponentCount() const { return static_cast<int>(m_active.size()); }
+
+private:
+    struct Entry {
+        SpatialGrid::ProxyId proxy = SpatialGrid::NULL_PROXY;
+        uint32_t frame = 0;
+    };
+
+    void gather(const std::vector<std::unique_ptr<ActorObjectExtended>>& actors);
+    void findPairs();
+    void dispatch();
+
+    SpatialGrid m_grid;
+    std::unordered_map<CollisionComponent*, Entry> m_entries;
+    std::vector<std::pair<CollisionComponent*, SpatialGrid::ProxyId>> m_active;
+    std::vector<SpatialGrid::ProxyId> m_candidates;
+    std::vector<CollisionPair> m_pairs;
+    uint32_t m_frame = 0;
+};
+
+} // namespace engine
@@ -0,0 +1,506 @@
+/**
+ * @file DynamicAABBTree.cpp
+ * @brief Implementation of DynamicAABBTree
+ */
+#include "DynamicAABBTree.h"
+#include <algorithm>
+#include <cmath>
+
+namespace engine {
+
+DynamicAABBTree::AABB DynamicAABBTree::AABB::combine(const AABB& a, const AABB& b) {
+    AABB result;
+    result.minX = std::min(a.minX, b.minX);
+    result.minY = std::min(a.minY, b.minY);
+    result.maxX = std::max(a.maxX, b.maxX);
+    result.maxY = std::max(a.maxY, b.maxY);
+    return result;
+}
+
+DynamicAABBTree::DynamicAABBTree(float fatMargin)
+    : m_fatMargin(fatMargin)
+{
+}
+
+void DynamicAABBTree::clear() {
+    m_nodes.clear();
+    m_root = NULL_NODE;
+    m_freeList = NULL_NODE;
+    m_proxyCount = 0;
+    clearBodies();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// NODE POOL
+// ═══════════════════════════════════════════════════════════════════════════
+
+int DynamicAABBTree::allocateNode() {
+    int nodeId;
+    if (m_freeList != NULL_NODE) {
+        nodeId = m_freeList;
+        m_freeList = m_nodes[nodeId].parent;
+    } else {
+        nodeId = static_cast<int>(m_nodes.size());
+        m_nodes.emplace_back();
+    }
+
+    TreeNode& node = m_nodes[nodeId];
+    node = TreeNode{};
+    node.height = 0;
+    return nodeId;
+}
+
+void DynamicAABBTree::freeNode(int nodeId) {
+    TreeNode& node = m_nodes[nodeId];
+    node.userData = nullptr;
+    node.child1 = NULL_NODE;
+    node.child2 = NULL_NODE;
+    node.height = -1;
+    node.parent = m_freeList;
+    m_freeList = nodeId;
+}
+
+DynamicAABBTree::AABB DynamicAABBTree::toAABB(const SDL_Rect& rect) {
+    AABB aabb;
+    aabb.minX = static_cast<float>(rect.x);
+    aabb.minY = static_cast<float>(rect.y);
+    aabb.maxX = aabb.minX + static_cast<float>(std::max(rect.w, 0));
+    aabb.maxY = aabb.minY + static_cast<float>(std::max(rect.h, 0));
+    return aabb;
+}
+
+DynamicAABBTree::AABB DynamicAABBTree::fatten(const SDL_Rect& bounds) const {
+    AABB aabb = toAABB(bounds);
+    aabb.minX -= m_fatMargin;
+    aabb.minY -= m_fatMargin;
+    aabb.maxX += m_fatMargin;
+    aabb.maxY += m_fatMargin;
+    return aabb;
+}
+
+bool DynamicAABBTree::isValidLeaf(ProxyId proxyId) const {
+    return proxyId >= 0 && proxyId < static_cast<int>(m_nodes.size()) &&
+           m_nodes[proxyId].height == 0;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// PROXIES
+// ═══════════════════════════════════════════════════════════════════════════
+
+DynamicAABBTree::ProxyId DynamicAABBTree::createProxy(const SDL_Rect& bounds, void* userData) {
+    int leaf = allocateNode();
+    TreeNode& node = m_nodes[leaf];
+    node.aabb = fatten(bounds);
+    node.bounds = bounds;
+    node.userData = userData;
+
+    insertLeaf(leaf);
+    m_proxyCount++;
+    return leaf;
+}
+
+void DynamicAABBTree::moveProxy(ProxyId proxyId, const SDL_Rect& bounds) {
+    if (!isValidLeaf(proxyId)) return;
+
+    TreeNode& node = m_nodes[proxyId];
+    node.bounds = bounds;
+
+    AABB tight = toAABB(bounds);
+    if (node.aabb.contains(tight)) {
+        // Still inside the fat AABB - but shrink if it got much too large
+        AABB huge = fatten(bounds);
+        float grow = 4.0f * m_fatMargin;
+        huge.minX -= grow;
+        huge.minY -= grow;
+        huge.maxX += grow;
+        huge.maxY += grow;
+        if (huge.contains(node.aabb)) {
+            return;
+        }
+    }
+
+    removeLeaf(proxyId);
+    m_nodes[proxyId].aabb = fatten(bounds);
+    insertLeaf(proxyId);
+}
+
+void DynamicAABBTree::destroyProxy(ProxyId proxyId) {
+    if (!isValidLeaf(proxyId)) return;
+
+    removeLeaf(proxyId);
+    freeNode(proxyId);
+    m_proxyCount--;
+}
+
+void* DynamicAABBTree::getUserData(ProxyId proxyId) const {
+    if (!isValidLeaf(proxyId)) return nullptr;
+    return m_nodes[proxyId].userData;
+}
+
+const SDL_Rect& DynamicAABBTree::getBounds(ProxyId proxyId) const {
+    static const SDL_Rect EMPTY{0, 0, 0, 0};
+    if (!isValidLeaf(proxyId)) return EMPTY;
+    return m_nodes[proxyId].bounds;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TREE MAINTENANCE
+// ═══════════════════════════════════════════════════════════════════════════
+
+void DynamicAABBTree::insertLeaf(int leaf) {
+    if (m_root == NULL_NODE) {
+        m_root = leaf;
+        m_nodes[leaf].parent = NULL_NODE;
+        return;
+    }
+
+    // Find the best sibling using the surface area heuristic
+    AABB leafAABB = m_nodes[leaf].aabb;
+    int index = m_root;
+    while (!m_nodes[index].isLeaf()) {
+        const TreeNode& node = m_nodes[index];
+        int child1 = node.child1;
+        int child2 = node.child2;
+
+        float area = node.aabb.perimeter();
+        float combinedArea = AABB::combine(node.aabb, leafAABB).perimeter();
+
+        // Cost of creating a new parent for this node and the new leaf
+        float cost = 2.0f * combinedArea;
+
+        // Minimum cost of pushing the leaf further down the tree
+        float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto descendCost = [&](int child) {
+            const TreeNode& c = m_nodes[child];
+            AABB combined = AABB::combine(leafAABB, c.aabb);
+            if (c.isLeaf()) {
+                return combined.perimeter() + inheritanceCost;
+            }
+            return (combined.perimeter() - c.aabb.perimeter()) + inheritanceCost;
+        };
+
+        float cost1 = descendCost(child1);
+        float cost2 = descendCost(child2);
+
+        if (cost < cost1 && cost < cost2) {
+            break;
+        }
+
+        index = (cost1 < cost2) ? child1 : child2;
+    }
+
+    int sibling = index;
+
+    // Create a new parent
+    int oldParent = m_nodes[sibling].parent;
+    int newParent = allocateNode();
+    m_nodes[newParent].parent = oldParent;
+    m_nodes[newParent].aabb = AABB::combine(leafAABB, m_nodes[sibling].aabb);
+    m_nodes[newParent].height = m_nodes[sibling].height + 1;
+    m_nodes[newParent].child1 = sibling;
+    m_nodes[newParent].child2 = leaf;
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leaf].parent = newParent;
+
+    if (oldParent != NULL_NODE) {
+        if (m_nodes[oldParent].child1 == sibling) {
+            m_nodes[oldParent].child1 = newParent;
+        } else {
+            m_nodes[oldParent].child2 = newParent;
+        }
+    } else {
+        m_root = newParent;
+    }
+
+    refitFrom(m_nodes[leaf].parent);
+}
+
+void DynamicAABBTree::removeLeaf(int leaf) {
+    if (leaf == m_root) {
+        m_root = NULL_NODE;
+        return;
+    }
+
+    int parent = m_nodes[leaf].parent;
+    int grandParent = m_nodes[parent].parent;
+    int sibling = (m_nodes[parent].child1 == leaf) ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+    if (grandParent != NULL_NODE) {
+        // Destroy parent and connect sibling to grandparent
+        if (m_nodes[grandParent].child1 == parent) {
+            m_nodes[grandParent].child1 = sibling;
+        } else {
+            m_nodes[grandParent].child2 = sibling;
+        }
+        m_nodes[sibling].parent = grandParent;
+        freeNode(parent);
+
+        refitFrom(grandParent);
+    } else {
+        m_root = sibling;
+        m_nodes[sibling].parent = NULL_NODE;
+        freeNode(parent);
+    }
+}
+
+void DynamicAABBTree::refitFrom(int nodeId) {
+    // Walk back up, rebalancing and refitting ancestors
+    int index = nodeId;
+    while (index != NULL_NODE) {
+        index = balance(index);
+
+        TreeNode& node = m_nodes[index];
+        const TreeNode& child1 = m_nodes[node.child1];
+        const TreeNode& child2 = m_nodes[node.child2];
+
+        node.height = 1 + std::max(child1.height, child2.height);
+        node.aabb = AABB::combine(child1.aabb, child2.aabb);
+
+        index = node.parent;
+    }
+}
+
+int DynamicAABBTree::balance(int iA) {
+    // Perform a left or right rotation if node A is imbalanced.
+    // Returns the new root index of the subtree.
+    TreeNode* A = &m_nodes[iA];
+    if (A->isLeaf() || A->height < 2) {
+        return iA;
+    }
+
+    int iB = A->child1;
+    int iC = A->child2;
+    TreeNode* B = &m_nodes[iB];
+    TreeNode* C = &m_nodes[iC];
+
+    int heightDiff = C->height - B->height;
+
+    // Rotate C up
+    if (heightDiff > 1) {
+        int iF = C->child1;
+        int iG = C->child2;
+        TreeNode* F = &m_nodes[iF];
+        TreeNode* G = &m_nodes[iG];
+
+        // Swap A and C
+        C->child1 = iA;
+        C->parent = A->parent;
+        A->parent = iC;
+
+        // A's old parent should point to C
+        if (C->parent != NULL_NODE) {
+            if (m_nodes[C->parent].child1 == iA) {
+                m_nodes[C->parent].child1 = iC;
+            } else {
+                m_nodes[C->parent].child2 = iC;
+            }
+        } else {
+            m_root = iC;
+        }
+
+        // Rotate
+        if (F->height > G->height) {
+            C->child2 = iF;
+            A->child2 = iG;
+            G->parent = iA;
+            A->aabb = AABB::combine(B->aabb, G->aabb);
+            C->aabb = AABB::combine(A->aabb, F->aabb);
+
+            A->height = 1 + std::max(B->height, G->height);
+            C->height = 1 + std::max(A->height, F->height);
+        } else {
+            C->child2 = iG;
+            A->child2 = iF;
+            F->parent = iA;
+            A->aabb = AABB::combine(B->aabb, F->aabb);
+            C->aabb = AABB::combine(A->aabb, G->aabb);
+
+            A->height = 1 + std::max(B->height, F->height);
+            C->height = 1 + std::max(A->height, G->height);
+        }
+
+        return iC;
+    }
+
+    // Rotate B up
+    if (heightDiff < -1) {
+        int iD = B->child1;
+        int iE = B->child2;
+        TreeNode* D = &m_nodes[iD];
+        TreeNode* E = &m_nodes[iE];
+
+        // Swap A and B
+        B->child1 = iA;
+        B->parent = A->parent;
+        A->parent = iB;
+
+        // A's old parent should point to B
+        if (B->parent != NULL_NODE) {
+            if (m_nodes[B->parent].child1 == iA) {
+                m_nodes[B->parent].child1 = iB;
+            } else {
+                m_nodes[B->parent].child2 = iB;
+            }
+        } else {
+            m_root = iB;
+        }
+
+        // Rotate
+        if (D->height > E->height) {
+            B->child2 = iD;
+            A->child1 = iE;
+            E->parent = iA;
+            A->aabb = AABB::combine(C->aabb, E->aabb);
+            B->aabb = AABB::combine(A->aabb, D->aabb);
+
+            A->height = 1 + std::max(C->height, E->height);
+            B->height = 1 + std::max(A->height, D->height);
+        } else {
+            B->child2 = iE;
+            A->child1 = iD;
+            D->parent = iA;
+            A->aabb = AABB::combine(C->aabb, D->aabb);
+            B->aabb = AABB::combine(A->aabb, E->aabb);
+
+            A->height = 1 + std::max(C->height, D->height);
+            B->height = 1 + std::max(A->height, E->height);
+        }
+
+        return iB;
+    }
+
+    return iA;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// QUERIES
+// ═══════════════════════════════════════════════════════════════════════════
+
+void DynamicAABBTree::queryRect(const SDL_Rect& rect, std::vector<ProxyId>& out) const {
+    if (m_root == NULL_NODE) return;
+
+    AABB queryAABB = toAABB(rect);
+    m_stack.clear();
+    m_stack.push_back(m_root);
+
+    while (!m_stack.empty()) {
+        int nodeId = m_stack.back();
+        m_stack.pop_back();
+
+        const TreeNode& node = m_nodes[nodeId];
+        if (!node.aabb.overlaps(queryAABB)) continue;
+
+        if (node.isLeaf()) {
+            if (rectsOverlap(node.bounds, rect)) {
+                out.push_back(nodeId);
+            }
+        } else {
+            m_stack.push_back(node.child1);
+            m_stack.push_back(node.child2);
+        }
+    }
+}
+
+void DynamicAABBTree::queryPoint(const Vec2& point, std::vector<ProxyId>& out) const {
+    if (m_root == NULL_NODE) return;
+
+    m_stack.clear();
+    m_stack.push_back(m_root);
+
+    while (!m_stack.empty()) {
+        int nodeId = m_stack.back();
+        m_stack.pop_back();
+
+        const TreeNode& node = m_nodes[nodeId];
+        if (point.x < node.aabb.minX || point.x > node.aabb.maxX ||
+            point.y < node.aabb.minY || point.y > node.aabb.maxY) {
+            continue;
+        }
+
+        if (node.isLeaf()) {
+            if (rectContains(node.bounds, point)) {
+                out.push_back(nodeId);
+            }
+        } else {
+            m_stack.push_back(node.child1);
+            m_stack.push_back(node.child2);
+        }
+    }
+}
+
+void DynamicAABBTree::queryRay(const Vec2& start, const Vec2& end, std::vector<ProxyId>& out) const {
+    if (m_root == NULL_NODE) return;
+
+    // Segment AABB prunes most of the tree before the slab test
+    AABB segmentAABB;
+    segmentAABB.minX = std::min(start.x, end.x);
+    segmentAABB.minY = std::min(start.y, end.y);
+    segmentAABB.maxX = std::max(start.x, end.x);
+    segmentAABB.maxY = std::max(start.y, end.y);
+
+    Vec2 d = end - start;
+    // Separating axis: |dot(perp(d), center - start)| > dot(|perp(d)|, extents)
+    Vec2 perp(-d.y, d.x);
+    Vec2 absPerp(std::abs(perp.x), std::abs(perp.y));
+
+    m_stack.clear();
+    m_stack.push_back(m_root);
+
+    while (!m_stack.empty()) {
+        int nodeId = m_stack.back();
+        m_stack.pop_back();
+
+        const TreeNode& node = m_nodes[nodeId];
+        if (!node.aabb.overlaps(segmentAABB)) continue;
+
+        Vec2 center((node.aabb.minX + node.aabb.maxX) * 0.5f, (node.aabb.minY + node.aabb.maxY) * 0.5f);
+        Vec2 extents((node.aabb.maxX - node.aabb.minX) * 0.5f, (node.aabb.maxY - node.aabb.minY) * 0.5f);
+        float separation = std::abs(perp.dot(center - start)) - absPerp.dot(extents);
+        if (separation > 0.0f) continue;
+
+        if (node.isLeaf()) {
+            if (segmentOverlapsRect(start, end, node.bounds)) {
+                out.push_back(nodeId);
+            }
+        } else {
+            m_stack.push_back(node.child1);
+            m_stack.push_back(node.child2);
+        }
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DIAGNOSTICS
+// ═══════════════════════════════════════════════════════════════════════════
+
+int DynamicAABBTree::getHeight() const {
+    if (m_root == NULL_NODE) return -1;
+    return m_nodes[m_root].height;
+}
+
+int DynamicAABBTree::getMaxBalance() const {
+    int maxBalance = 0;
+    for (const TreeNode& node : m_nodes) {
+        if (node.height <= 1) continue;
+        int diff = std::abs(m_nodes[node.child2].height - m_nodes[node.child1].height);
+        maxBalance = std::max(maxBalance, diff);
+    }
+    return maxBalance;
+}
+
+float DynamicAABBTree::getAreaRatio() const {
+    if (m_root == NULL_NODE) return 0.0f;
+
+    float rootArea = m_nodes[m_root].aabb.perimeter();
+    if (rootArea <= 0.0f) return 0.0f;
+
+    float totalArea = 0.0f;
+    for (const TreeNode& node : m_nodes) {
+        if (node.height < 0 || node.isLeaf()) continue;
+        totalArea += node.aabb.perimeter();
+    }
+    return totalArea / rootArea;
+}
+
+} // namespace engine
@@ -0,0 +1,139 @@
+/**
+ * @file DynamicAABBTree.h
+ * @brief Dynamic AABB tree broad phase (alternative to SpatialGrid)
+ */
+#pragma once
+
+#include "IBroadPhase.h"
+#include <vector>
+
+namespace engine {
+
+/**
+ * @brief Bounding volume hierarchy with incremental updates
+ *
+ * Leaves store a fattened AABB (bounds grown by a margin), so small moves
+ * don't touch the tree at all. When a proxy leaves its fat AABB it is
+ * removed and reinserted using the surface area heuristic, refitting
+ * ancestors on the way up and applying AVL-style rotations to keep the
+ * tree balanced.
+ *
+ * Cost scales with proxy count rather than world size, which suits scenes
+ * that mix huge static colliders (walls, SceneData::collisionBoxes) with
+ * many small bodies.
+ *
+ * Example:
+ * @code
+ * DynamicAABBTree tree(8.0f);
+ * tree.insert(body);
+ * tree.move(body);                 // cheap while inside its fat AABB
+ * std::vector<PhysicsBody*> hits;
+ * tree.query(body, hits);
+ * @endcode
+ *
+ * @par Thread Safety
+ * Not thread-safe. Queries reuse an internal traversal stack.
+ */
+class DynamicAABBTree : public IBroadPhase {
+public:
+    using IBroadPhase::queryRect;
+
+    /**
+     * @param fatMargin Pixels added on each side of leaf bounds
+     */
+    explicit DynamicAABBTree(float fatMargin = 8.0f);
+    ~DynamicAABBTree() override = default;
+
+    void clear() override;
+
+    // ═══════════════════════════════════════════════════════════════════
+    // PROXIES
+    // ═══════════════════════════════════════════════════════════════════
+
+    ProxyId createProxy(const SDL_Rect& bounds, void* userData) override;
+
+    /** @brief Update bounds, reinserts only if the fat AABB no longer contains them */
+    void moveProxy(ProxyId proxyId, const SDL_Rect& bounds) override;
+
+    void destroyProxy(ProxyId proxyId) override;
+
+    void* getUserData(ProxyId proxyId) const override;
+    const SDL_Rect& getBounds(ProxyId proxyId) const override;
+    int getProxyCount() const override { return m_proxyCount; }
+
+    // ═══════════════════════════════════════════════════════════════════
+    // QUERIES
+    // ═══════════════════════════════════════════════════════════════════
+
+    void queryRect(const SDL_Rect& rect, std::vector<ProxyId>& out) const override;
+    void queryPoint(const Vec2& point, std::vector<ProxyId>& out) const override;
+    void queryRay(const Vec2& start, const Vec2& end, std::vector<ProxyId>& out) const override;
+
+    // ═══════════════════════════════════════════════════════════════════
+    // DIAGNOSTICS
+    // ═══════════════════════════════════════════════════════════════════
+
+    /** @brief Height of the tree (0 for a single leaf, -1 when empty) */
+    int getHeight() const;
+
+    /** @brief Max height difference between sibling subtrees */
+    int getMaxBalance() const;
+
+    /** @brief Sum of internal node perimeters divided by root perimeter */
+    float getAreaRatio() const;
+
+    float getFatMargin() const { return m_fatMargin; }
+    void setFatMargin(float margin) { m_fatMargin = margin; }
+
+private:
+    struct AABB {
+        float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+
+        float perimeter() const { return 2.0f * ((maxX - minX) + (maxY - minY)); }
+        bool contains(const AABB& other) const {
+            return minX <= other.minX && minY <= other.minY &&
+                   other.maxX <= maxX && other.maxY <= maxY;
+        }
+        bool overlaps(const AABB& other) const {
+            return minX <= other.maxX && other.minX <= maxX &&
+                   minY <= other.maxY && other.minY <= maxY;
+        }
+        static AABB combine(const AABB& a, const AABB& b);
+    };
+
+    static constexpr int NULL_NODE = -1;
+
+    struct TreeNode {
+        AABB aabb;              ///< Fat AABB for leaves, union for internal nodes
+        SDL_Rect bounds{0, 0, 0, 0}; ///< Tight bounds (leaves only)
+        void* userData = nullptr;
+        int parent = NULL_NODE; ///< Also next free node when unused
+        int child1 = NULL_NODE;
+        int child2 = NULL_NODE;
+        int height = -1;        ///< Leaf = 0, free = -1
+
+        bool isLeaf() const { return child1 == NULL_NODE; }
+    };
+
+    int allocateNode();
+    void freeNode(int nodeId);
+
+    void insertLeaf(int leaf);
+    void removeLeaf(int leaf);
+    int balance(int nodeId);
+    void refitFrom(int nodeId);
+
+    AABB fatten(const SDL_Rect& bounds) const;
+    static AABB toAABB(const SDL_Rect& rect);
+    bool isValidLeaf(ProxyId proxyId) const;
+
+    std::vector<TreeNode> m_nodes;
+    int m_root = NULL_NODE;
+    int m_freeList = NULL_NODE;
+    int m_proxyCount = 0;
+    float m_fatMargin;
+
+    mutable std::vector<int> m_stack;
+};
+
+} // namespace engine
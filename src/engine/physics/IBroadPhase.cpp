@@ -0,0 +1,140 @@
+/**
+ * @file IBroadPhase.cpp
+ * @brief Shared PhysicsBody helpers and geometry tests for broad phases
+ */
+#include "IBroadPhase.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace engine {
+
+// ═══════════════════════════════════════════════════════════════════════════
+// PHYSICS BODIES
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool IBroadPhase::computeBodyBounds(const PhysicsBody* body, SDL_Rect& outBounds) {
+    if (!body) return false;
+
+    bool found = false;
+    for (const auto& shape : body->getShapes()) {
+        if (!shape) continue;
+        SDL_Rect bounds = shape->getBounds();
+        if (!found) {
+            outBounds = bounds;
+            found = true;
+        } else {
+            int minX = std::min(outBounds.x, bounds.x);
+            int minY = std::min(outBounds.y, bounds.y);
+            int maxX = std::max(outBounds.x + outBounds.w, bounds.x + bounds.w);
+            int maxY = std::max(outBounds.y + outBounds.h, bounds.y + bounds.h);
+            outBounds = SDL_Rect{minX, minY, maxX - minX, maxY - minY};
+        }
+    }
+    return found;
+}
+
+void IBroadPhase::insert(PhysicsBody* body) {
+    if (!body) return;
+    if (m_bodyProxies.count(body)) {
+        move(body);
+        return;
+    }
+
+    SDL_Rect bounds;
+    if (!computeBodyBounds(body, bounds)) return;
+
+    m_bodyProxies[body] = createProxy(bounds, body);
+}
+
+void IBroadPhase::move(PhysicsBody* body) {
+    auto it = m_bodyProxies.find(body);
+    if (it == m_bodyProxies.end()) return;
+
+    SDL_Rect bounds;
+    if (!computeBodyBounds(body, bounds)) return;
+
+    moveProxy(it->second, bounds);
+}
+
+void IBroadPhase::remove(PhysicsBody* body) {
+    auto it = m_bodyProxies.find(body);
+    if (it == m_bodyProxies.end()) return;
+
+    destroyProxy(it->second);
+    m_bodyProxies.erase(it);
+}
+
+void IBroadPhase::query(const PhysicsBody* body, std::vector<PhysicsBody*>& out) const {
+    auto it = m_bodyProxies.find(body);
+    if (it == m_bodyProxies.end()) return;
+
+    m_bodyScratch.clear();
+    queryRect(getBounds(it->second), m_bodyScratch);
+
+    for (ProxyId proxyId : m_bodyScratch) {
+        if (proxyId == it->second) continue;
+        out.push_back(static_cast<PhysicsBody*>(getUserData(proxyId)));
+    }
+}
+
+void IBroadPhase::queryRect(const SDL_Rect& rect, std::vector<PhysicsBody*>& out) const {
+    m_bodyScratch.clear();
+    queryRect(rect, m_bodyScratch);
+
+    for (ProxyId proxyId : m_bodyScratch) {
+        out.push_back(static_cast<PhysicsBody*>(getUserData(proxyId)));
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// GEOMETRY HELPERS
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool IBroadPhase::rectsOverlap(const SDL_Rect& a, const SDL_Rect& b) {
+    // Inclusive test: touching edges count as candidates for the narrow phase
+    return static_cast<int64_t>(a.x) <= static_cast<int64_t>(b.x) + b.w &&
+           static_cast<int64_t>(b.x) <= static_cast<int64_t>(a.x) + a.w &&
+           static_cast<int64_t>(a.y) <= static_cast<int64_t>(b.y) + b.h &&
+           static_cast<int64_t>(b.y) <= static_cast<int64_t>(a.y) + a.h;
+}
+
+bool IBroadPhase::rectContains(const SDL_Rect& rect, const Vec2& point) {
+    return point.x >= static_cast<float>(rect.x) &&
+           point.x <= static_cast<float>(rect.x) + static_cast<float>(rect.w) &&
+           point.y >= static_cast<float>(rect.y) &&
+           point.y <= static_cast<float>(rect.y) + static_cast<float>(rect.h);
+}
+
+bool IBroadPhase::segmentOverlapsRect(const Vec2& start, const Vec2& end, const SDL_Rect& rect) {
+    float minX = static_cast<float>(rect.x);
+    float minY = static_cast<float>(rect.y);
+    float maxX = minX + static_cast<float>(rect.w);
+    float maxY = minY + static_cast<float>(rect.h);
+
+    float tMin = 0.0f;
+    float tMax = 1.0f;
+    Vec2 d = end - start;
+
+    const float origin[2] = {start.x, start.y};
+    const float dir[2] = {d.x, d.y};
+    const float lo[2] = {minX, minY};
+    const float hi[2] = {maxX, maxY};
+
+    for (int axis = 0; axis < 2; axis++) {
+        if (std::abs(dir[axis]) < 1e-8f) {
+            if (origin[axis] < lo[axis] || origin[axis] > hi[axis]) return false;
+            continue;
+        }
+        float inv = 1.0f / dir[axis];
+        float t1 = (lo[axis] - origin[axis]) * inv;
+        float t2 = (hi[axis] - origin[axis]) * inv;
+        if (t1 > t2) std::swap(t1, t2);
+        tMin = std::max(tMin, t1);
+        tMax = std::min(tMax, t2);
+        if (tMin > tMax) return false;
+    }
+    return true;
+}
+
+} // namespace engine
@@ -0,0 +1,114 @@
+/**
+ * @file IBroadPhase.h
+ * @brief Common interface for broad phase structures (SpatialGrid, DynamicAABBTree)
+ */
+#pragma once
+
+#include "PhysicsBody.h"
+#include "core/Vec2.h"
+#include <SDL.h>
+#include <vector>
+#include <unordered_map>
+
+namespace engine {
+
+/**
+ * @brief Abstract broad phase for the legacy PhysicsBody/CollisionShape path
+ *
+ * Entries are proxies with integer bounds and user data. Queries append
+ * matching proxy ids to a caller-supplied buffer and never return duplicates.
+ * PhysicsBody helpers are built on top of the proxy API so every broad phase
+ * can be swapped without touching callers.
+ *
+ * @par Thread Safety
+ * Not thread-safe. Queries may update internal scratch state.
+ */
+class IBroadPhase {
+public:
+    using ProxyId = int;
+    static constexpr ProxyId NULL_PROXY = -1;
+
+    virtual ~IBroadPhase() = default;
+
+    /** @brief Remove all proxies */
+    virtual void clear() = 0;
+
+    // ═══════════════════════════════════════════════════════════════════
+    // PROXIES
+    // ═══════════════════════════════════════════════════════════════════
+
+    /** @brief Add a proxy covering bounds, returns its id */
+    virtual ProxyId createProxy(const SDL_Rect& bounds, void* userData) = 0;
+
+    /** @brief Update proxy bounds */
+    virtual void moveProxy(ProxyId proxyId, const SDL_Rect& bounds) = 0;
+
+    /** @brief Remove proxy (id may be reused) */
+    virtual void destroyProxy(ProxyId proxyId) = 0;
+
+    virtual void* getUserData(ProxyId proxyId) const = 0;
+    virtual const SDL_Rect& getBounds(ProxyId proxyId) const = 0;
+
+    /** @brief Number of live proxies */
+    virtual int getProxyCount() const = 0;
+
+    // ═══════════════════════════════════════════════════════════════════
+    // QUERIES (results appended to out)
+    // ═══════════════════════════════════════════════════════════════════
+
+    /** @brief Proxies whose bounds overlap rect (touching edges included) */
+    virtual void queryRect(const SDL_Rect& rect, std::vector<ProxyId>& out) const = 0;
+
+    /** @brief Proxies whose bounds contain point */
+    virtual void queryPoint(const Vec2& point, std::vector<ProxyId>& out) const = 0;
+
+    /** @brief Proxies whose bounds are crossed by the segment start-end */
+    virtual void queryRay(const Vec2& start, const Vec2& end, std::vector<ProxyId>& out) const = 0;
+
+    // ═══════════════════════════════════════════════════════════════════
+    // PHYSICS BODIES
+    // ═══════════════════════════════════════════════════════════════════
+
+    /** @brief Insert body using the union of its shape bounds */
+    void insert(PhysicsBody* body);
+
+    /** @brief Refresh body after it moved or its shapes changed */
+    void move(PhysicsBody* body);
+
+    /** @brief Remove body */
+    void remove(PhysicsBody* body);
+
+    /** @brief Potential collision candidates for a body, excluding itself */
+    void query(const PhysicsBody* body, std::vector<PhysicsBody*>& out) const;
+
+    /** @brief All bodies in a rectangular area */
+    void queryRect(const SDL_Rect& rect, std::vector<PhysicsBody*>& out) const;
+
+    /** @brief Union of all shape bounds of a body */
+    static bool computeBodyBounds(const PhysicsBody* body, SDL_Rect& outBounds);
+
+    // ═══════════════════════════════════════════════════════════════════
+    // GEOMETRY HELPERS
+    // ═══════════════════════════════════════════════════════════════════
+
+    /** @brief Inclusive rect overlap test (64-bit safe) */
+    static bool rectsOverlap(const SDL_Rect& a, const SDL_Rect& b);
+
+    /** @brief Inclusive point containment test */
+    static bool rectContains(const SDL_Rect& rect, const Vec2& point);
+
+    /** @brief Segment vs rect slab test */
+    static bool segmentOverlapsRect(const Vec2& start, const Vec2& end, const SDL_Rect& rect);
+
+protected:
+    IBroadPhase() = default;
+
+    /** @brief Called by clear() implementations to drop body mappings */
+    void clearBodies() { m_bodyProxies.clear(); }
+
+private:
+    std::unordered_map<const PhysicsBody*, ProxyId> m_bodyProxies;
+    mutable std::vector<ProxyId> m_bodyScratch;
+};
+
+} // namespace engine
@@ -0,0 +1,127 @@
+/**
+ * @file NarrowphaseBenchmark.cpp
+ * @brief Implementation of the narrowphase microbenchmark
+ */
+#include "NarrowphaseBenchmark.h"
+#include "ShapeBatch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace engine {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/** @brief Best wall time of iterations runs, in milliseconds */
+template<typename Fn>
+double bestOf(int iterations, Fn&& fn) {
+    double best = std::numeric_limits<double>::max();
+    for (int i = 0; i < std::max(1, iterations); i++) {
+        auto start = Clock::now();
+        fn();
+        std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+/** @brief Million pair tests per second */
+double throughput(long long pairs, double ms) {
+    return ms > 0.0 ? static_cast<double>(pairs) / (ms * 1000.0) : 0.0;
+}
+
+std::unique_ptr<CollisionShape> makeShape(std::mt19937& rng, bool circle) {
+    std::uniform_real_distribution<float> coord(0.0f, 2048.0f);
+    std::uniform_real_distribution<float> size(8.0f, 64.0f);
+
+    if (circle) {
+        return std::make_unique<CircleShape>(coord(rng), coord(rng), size(rng) * 0.5f);
+    }
+    return std::make_unique<AABBShape>(coord(rng), coord(rng), size(rng), size(rng));
+}
+
+} // namespace
+
+std::string NarrowphaseBenchmarkResult::summary() const {
+    std::ostringstream out;
+    out << "virtual: " << virtualMs << " ms (" << throughput(pairTests, virtualMs) << " Mpairs/s)"
+        << ", batch scalar: " << scalarMs << " ms (" << throughput(pairTests, scalarMs) << " Mpairs/s)"
+        << ", batch " << simdLevel << ": " << simdMs << " ms (" << throughput(pairTests, simdMs) << " Mpairs/s)"
+        << ", hits: " << virtualHits;
+    return out.str();
+}
+
+NarrowphaseBenchmarkResult runNarrowphaseBenchmark(const NarrowphaseBenchmarkSettings& settings) {
+    NarrowphaseBenchmarkResult result;
+    result.simdLevel = ShapeBatch::getSimdLevel();
+
+    const int shapeCount = std::max(1, settings.shapeCount);
+    const int queryCount = std::max(1, settings.queryCount);
+    std::mt19937 rng(settings.seed);
+
+    std::vector<std::unique_ptr<CollisionShape>> shapes;
+    shapes.reserve(shapeCount);
+    for (int i = 0; i < shapeCount; i++) {
+        shapes.push_back(makeShape(rng, i % 2 == 1));
+    }
+
+    std::vector<std::unique_ptr<CollisionShape>> queries;
+    queries.reserve(queryCount);
+    for (int i = 0; i < queryCount; i++) {
+        queries.push_back(makeShape(rng, i % 2 == 1));
+    }
+
+    ShapeBatch batch;
+    batch.reserve(shapeCount / 2 + 1, shapeCount / 2 + 1);
+    for (const auto& shape : shapes) {
+        batch.add(*shape);
+    }
+
+    result.pairTests = static_cast<long long>(shapeCount) * queryCount;
+
+    result.virtualMs = bestOf(settings.iterations, [&]() {
+        result.virtualHits = 0;
+        for (const auto& query : queries) {
+            for (const auto& shape : shapes) {
+                if (query->overlaps(*shape)) result.virtualHits++;
+            }
+        }
+    });
+
+    std::vector<uint32_t> hits;
+    hits.reserve(shapeCount);
+    auto runBatch = [&]() {
+        result.batchHits = 0;
+        for (const auto& query : queries) {
+            hits.clear();
+            result.batchHits += batch.query(*query, hits);
+        }
+    };
+
+    batch.setSimdEnabled(false);
+    result.scalarMs = bestOf(settings.iterations, runBatch);
+    long long scalarHits = result.batchHits;
+
+    batch.setSimdEnabled(true);
+    result.simdMs = bestOf(settings.iterations, runBatch);
+
+    if (result.batchHits != result.virtualHits || scalarHits != result.virtualHits) {
+        std::cerr << "[NarrowphaseBenchmark] Hit count mismatch: virtual " << result.virtualHits
+                  << ", scalar " << scalarHits << ", " << result.simdLevel << " "
+                  << result.batchHits << std::endl;
+    }
+
+    std::cout << "[NarrowphaseBenchmark] " << shapeCount << " shapes, " << queryCount
+              << " queries: " << result.summary() << std::endl;
+    return result;
+}
+
+} // namespace engine
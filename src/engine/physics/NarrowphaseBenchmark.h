@@ -0,0 +1,38 @@
+/**
+ * @file NarrowphaseBenchmark.h
+ * @brief Microbenchmark for ShapeBatch against CollisionShape::overlaps
+ */
+#pragma once
+
+#include <string>
+
+namespace engine {
+
+struct NarrowphaseBenchmarkSettings {
+    int shapeCount = 4096;          // Stored shapes, half AABBs and half circles
+    int queryCount = 512;           // Query shapes, alternating AABB/circle
+    int iterations = 5;             // Best time of N runs is reported
+    unsigned int seed = 1234;
+};
+
+struct NarrowphaseBenchmarkResult {
+    double virtualMs = 0.0;         // Pairwise CollisionShape::overlaps()
+    double scalarMs = 0.0;          // ShapeBatch with SIMD disabled
+    double simdMs = 0.0;            // ShapeBatch with the widest compiled kernel
+    long long virtualHits = 0;
+    long long batchHits = 0;        // Equal to virtualHits unless the paths disagree
+    long long pairTests = 0;        // Shape pairs tested per run
+    const char* simdLevel = "scalar";
+
+    std::string summary() const;
+};
+
+/**
+ * @brief Times one-against-all queries through the virtual path and ShapeBatch
+ *
+ * Shapes are random AABBs and circles in a 2048x2048 area, sized so every
+ * query hits a handful of them. Nothing touches the active scene.
+ */
+NarrowphaseBenchmarkResult runNarrowphaseBenchmark(const NarrowphaseBenchmarkSettings& settings);
+
+} // namespace engine
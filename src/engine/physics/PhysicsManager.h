@@ -40,7 +40,7 @@ public:
             m_world2D->initialize();
         } else {
             m_world3D = std::make_unique<PhysicsWorld3D>();
-            m_world3D->initialize();
+            m_world3D->initialize(m_settings3D);
         }
     }
     
@@ -49,11 +49,15 @@ public:
         m_world2D->initialize();
         
         m_world3D = std::make_unique<PhysicsWorld3D>();
-        m_world3D->initialize();
+        m_world3D->initialize(m_settings3D);
         
         m_dimension = PhysicsDimension::Physics3D;
     }
     
+    /** @brief Options for the 3D world, call before initialize() */
+    void setSettings3D(const WorldSettings3D& settings) { m_settings3D = settings; }
+    const WorldSettings3D& getSettings3D() const { return m_settings3D; }
+    
     void shutdown() {
         if (m_world2D) m_world2D->shutdown();
         if (m_world3D) m_world3D->shutdown();
@@ -84,6 +88,20 @@ public:
         }
     }
     
+    /** @brief Start the 3D step without waiting (see PhysicsWorld3D::beginStep) */
+    void beginStep3D(float deltaTime) {
+        if (m_world3D && m_world3D->isInitialized()) {
+            m_world3D->beginStep(deltaTime);
+        }
+    }
+    
+    /** @brief Wait for the step started by beginStep3D() */
+    void endStep3D() {
+        if (m_world3D && m_world3D->isInitialized()) {
+            m_world3D->endStep(true);
+        }
+    }
+    
     // ========================================================================
     // ACCESS
     // ========================================================================
@@ -116,6 +134,7 @@ public:
 private:
     std::unique_ptr<PhysicsWorld2D> m_world2D;
     std::unique_ptr<PhysicsWorld3D> m_world3D;
+    WorldSettings3D m_settings3D;
     PhysicsDimension m_dimension = PhysicsDimension::Physics3D;
 };
 
@@ -0,0 +1,350 @@
+/**
+ * @file ShapeBatch.cpp
+ * @brief Implementation of ShapeBatch
+ */
+#include "ShapeBatch.h"
+#include <algorithm>
+#include <limits>
+
+#if !defined(RETRO_NARROWPHASE_SCALAR)
+    #if defined(__AVX__)
+        #define RETRO_NARROWPHASE_AVX 1
+        #include <immintrin.h>
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define RETRO_NARROWPHASE_SSE2 1
+        #include <emmintrin.h>
+    #endif
+#endif
+
+namespace engine {
+
+namespace {
+
+constexpr float PAD_VALUE = std::numeric_limits<float>::quiet_NaN();
+
+#if defined(RETRO_NARROWPHASE_AVX)
+
+struct Simd {
+    using V = __m256;
+    static constexpr size_t WIDTH = 8;
+    static V load(const float* p) { return _mm256_loadu_ps(p); }
+    static V set1(float v) { return _mm256_set1_ps(v); }
+    static V add(V a, V b) { return _mm256_add_ps(a, b); }
+    static V sub(V a, V b) { return _mm256_sub_ps(a, b); }
+    static V mul(V a, V b) { return _mm256_mul_ps(a, b); }
+    static V min(V a, V b) { return _mm256_min_ps(a, b); }
+    static V max(V a, V b) { return _mm256_max_ps(a, b); }
+    static V lt(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static V le(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static V both(V a, V b) { return _mm256_and_ps(a, b); }
+    static int mask(V v) { return _mm256_movemask_ps(v); }
+};
+
+#elif defined(RETRO_NARROWPHASE_SSE2)
+
+struct Simd {
+    using V = __m128;
+    static constexpr size_t WIDTH = 4;
+    static V load(const float* p) { return _mm_loadu_ps(p); }
+    static V set1(float v) { return _mm_set1_ps(v); }
+    static V add(V a, V b) { return _mm_add_ps(a, b); }
+    static V sub(V a, V b) { return _mm_sub_ps(a, b); }
+    static V mul(V a, V b) { return _mm_mul_ps(a, b); }
+    static V min(V a, V b) { return _mm_min_ps(a, b); }
+    static V max(V a, V b) { return _mm_max_ps(a, b); }
+    static V lt(V a, V b) { return _mm_cmplt_ps(a, b); }
+    static V le(V a, V b) { return _mm_cmple_ps(a, b); }
+    static V both(V a, V b) { return _mm_and_ps(a, b); }
+    static int mask(V v) { return _mm_movemask_ps(v); }
+};
+
+#endif
+
+#if defined(RETRO_NARROWPHASE_AVX) || defined(RETRO_NARROWPHASE_SSE2)
+#define RETRO_NARROWPHASE_SIMD 1
+
+inline void appendLanes(int mask, size_t base, const std::vector<uint32_t>& index, std::vector<uint32_t>& out) {
+    for (size_t lane = 0; mask != 0; lane++, mask >>= 1) {
+        if (mask & 1) {
+            out.push_back(index[base + lane]);
+        }
+    }
+}
+#endif
+
+} // namespace
+
+// Note on operand order in the SIMD kernels: min/max return their second
+// operand when either input is NaN, so the per-shape value always goes
+// last. That way padding lanes stay NaN and fail the final comparison.
+
+void ShapeBatch::clear() {
+    // Shrink (capacity is kept) so stale values never end up in the padding
+    m_aabbs.minX.clear();
+    m_aabbs.minY.clear();
+    m_aabbs.maxX.clear();
+    m_aabbs.maxY.clear();
+    m_aabbs.index.clear();
+    m_aabbs.count = 0;
+
+    m_circles.x.clear();
+    m_circles.y.clear();
+    m_circles.radius.clear();
+    m_circles.index.clear();
+    m_circles.count = 0;
+
+    m_shapeCount = 0;
+}
+
+void ShapeBatch::reserve(size_t aabbCount, size_t circleCount) {
+    size_t aabbPadded = (aabbCount + SIMD_WIDTH - 1) / SIMD_WIDTH * SIMD_WIDTH;
+    m_aabbs.minX.reserve(aabbPadded);
+    m_aabbs.minY.reserve(aabbPadded);
+    m_aabbs.maxX.reserve(aabbPadded);
+    m_aabbs.maxY.reserve(aabbPadded);
+    m_aabbs.index.reserve(aabbPadded);
+
+    size_t circlePadded = (circleCount + SIMD_WIDTH - 1) / SIMD_WIDTH * SIMD_WIDTH;
+    m_circles.x.reserve(circlePadded);
+    m_circles.y.reserve(circlePadded);
+    m_circles.radius.reserve(circlePadded);
+    m_circles.index.reserve(circlePadded);
+}
+
+void ShapeBatch::pad(std::vector<float>& values, size_t count) {
+    if (count == values.size()) {
+        values.resize(values.size() + SIMD_WIDTH, PAD_VALUE);
+    }
+}
+
+uint32_t ShapeBatch::add(const CollisionShape& shape) {
+    switch (shape.getType()) {
+        case CollisionShape::Type::AABB:
+            return addAABB(static_cast<const AABBShape&>(shape).getRect());
+        case CollisionShape::Type::Circle: {
+            const auto& circle = static_cast<const CircleShape&>(shape);
+            return addCircle(circle.getCenter(), circle.getRadius());
+        }
+        case CollisionShape::Type::Polygon:
+            return INVALID_INDEX;
+    }
+    return INVALID_INDEX;
+}
+
+uint32_t ShapeBatch::addAABB(const SDL_Rect& rect) {
+    size_t slot = m_aabbs.count++;
+    pad(m_aabbs.minX, slot);
+    pad(m_aabbs.minY, slot);
+    pad(m_aabbs.maxX, slot);
+    pad(m_aabbs.maxY, slot);
+    if (slot == m_aabbs.index.size()) {
+        m_aabbs.index.resize(m_aabbs.index.size() + SIMD_WIDTH, INVALID_INDEX);
+    }
+
+    m_aabbs.minX[slot] = static_cast<float>(rect.x);
+    m_aabbs.minY[slot] = static_cast<float>(rect.y);
+    m_aabbs.maxX[slot] = static_cast<float>(rect.x + rect.w);
+    m_aabbs.maxY[slot] = static_cast<float>(rect.y + rect.h);
+    m_aabbs.index[slot] = m_shapeCount;
+    return m_shapeCount++;
+}
+
+uint32_t ShapeBatch::addCircle(const Vec2& center, float radius) {
+    size_t slot = m_circles.count++;
+    pad(m_circles.x, slot);
+    pad(m_circles.y, slot);
+    pad(m_circles.radius, slot);
+    if (slot == m_circles.index.size()) {
+        m_circles.index.resize(m_circles.index.size() + SIMD_WIDTH, INVALID_INDEX);
+    }
+
+    m_circles.x[slot] = center.x;
+    m_circles.y[slot] = center.y;
+    m_circles.radius[slot] = radius;
+    m_circles.index[slot] = m_shapeCount;
+    return m_shapeCount++;
+}
+
+int ShapeBatch::query(const CollisionShape& shape, std::vector<uint32_t>& out) const {
+    switch (shape.getType()) {
+        case CollisionShape::Type::AABB:
+            return queryAABB(static_cast<const AABBShape&>(shape).getRect(), out);
+        case CollisionShape::Type::Circle: {
+            const auto& circle = static_cast<const CircleShape&>(shape);
+            return queryCircle(circle.getCenter(), circle.getRadius(), out);
+        }
+        case CollisionShape::Type::Polygon:
+            return 0;
+    }
+    return 0;
+}
+
+int ShapeBatch::queryAABB(const SDL_Rect& rect, std::vector<uint32_t>& out) const {
+    size_t before = out.size();
+    float minX = static_cast<float>(rect.x);
+    float minY = static_cast<float>(rect.y);
+    float maxX = static_cast<float>(rect.x + rect.w);
+    float maxY = static_cast<float>(rect.y + rect.h);
+
+    // SDL_HasIntersection never reports an empty rect
+    if (rect.w > 0 && rect.h > 0) {
+        queryAABBvsAABB(minX, minY, maxX, maxY, out);
+    }
+    queryAABBvsCircle(minX, minY, maxX, maxY, out);
+    return static_cast<int>(out.size() - before);
+}
+
+int ShapeBatch::queryCircle(const Vec2& center, float radius, std::vector<uint32_t>& out) const {
+    size_t before = out.size();
+    queryCirclevsAABB(center.x, center.y, radius, out);
+    queryCirclevsCircle(center.x, center.y, radius, out);
+    return static_cast<int>(out.size() - before);
+}
+
+const char* ShapeBatch::getSimdLevel() {
+#if defined(RETRO_NARROWPHASE_AVX)
+    return "avx";
+#elif defined(RETRO_NARROWPHASE_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// KERNELS
+// ═══════════════════════════════════════════════════════════════════════════
+
+void ShapeBatch::queryAABBvsAABB(float minX, float minY, float maxX, float maxY,
+                                 std::vector<uint32_t>& out) const {
+    const AABBArrays& a = m_aabbs;
+
+#if defined(RETRO_NARROWPHASE_SIMD)
+    if (m_simdEnabled) {
+        Simd::V qMinX = Simd::set1(minX), qMinY = Simd::set1(minY);
+        Simd::V qMaxX = Simd::set1(maxX), qMaxY = Simd::set1(maxY);
+        for (size_t i = 0; i < a.count; i += Simd::WIDTH) {
+            Simd::V bMinX = Simd::load(&a.minX[i]), bMinY = Simd::load(&a.minY[i]);
+            Simd::V bMaxX = Simd::load(&a.maxX[i]), bMaxY = Simd::load(&a.maxY[i]);
+
+            // Strict overlap on both axes, and the stored rect must be non-empty
+            Simd::V hit = Simd::both(Simd::lt(bMinX, qMaxX), Simd::lt(qMinX, bMaxX));
+            hit = Simd::both(hit, Simd::both(Simd::lt(bMinY, qMaxY), Simd::lt(qMinY, bMaxY)));
+            hit = Simd::both(hit, Simd::both(Simd::lt(bMinX, bMaxX), Simd::lt(bMinY, bMaxY)));
+
+            if (int mask = Simd::mask(hit)) {
+                appendLanes(mask, i, a.index, out);
+            }
+        }
+        return;
+    }
+#endif
+
+    for (size_t i = 0; i < a.count; i++) {
+        if (a.minX[i] < maxX && minX < a.maxX[i] &&
+            a.minY[i] < maxY && minY < a.maxY[i] &&
+            a.minX[i] < a.maxX[i] && a.minY[i] < a.maxY[i]) {
+            out.push_back(a.index[i]);
+        }
+    }
+}
+
+void ShapeBatch::queryAABBvsCircle(float minX, float minY, float maxX, float maxY,
+                                   std::vector<uint32_t>& out) const {
+    const CircleArrays& c = m_circles;
+
+#if defined(RETRO_NARROWPHASE_SIMD)
+    if (m_simdEnabled) {
+        Simd::V qMinX = Simd::set1(minX), qMinY = Simd::set1(minY);
+        Simd::V qMaxX = Simd::set1(maxX), qMaxY = Simd::set1(maxY);
+        for (size_t i = 0; i < c.count; i += Simd::WIDTH) {
+            Simd::V x = Simd::load(&c.x[i]), y = Simd::load(&c.y[i]);
+            Simd::V r = Simd::load(&c.radius[i]);
+
+            // Closest point on the query rect to each center
+            Simd::V dx = Simd::sub(x, Simd::max(qMinX, Simd::min(qMaxX, x)));
+            Simd::V dy = Simd::sub(y, Simd::max(qMinY, Simd::min(qMaxY, y)));
+            Simd::V distSq = Simd::add(Simd::mul(dx, dx), Simd::mul(dy, dy));
+
+            if (int mask = Simd::mask(Simd::le(distSq, Simd::mul(r, r)))) {
+                appendLanes(mask, i, c.index, out);
+            }
+        }
+        return;
+    }
+#endif
+
+    for (size_t i = 0; i < c.count; i++) {
+        float dx = c.x[i] - std::max(minX, std::min(c.x[i], maxX));
+        float dy = c.y[i] - std::max(minY, std::min(c.y[i], maxY));
+        if (dx * dx + dy * dy <= c.radius[i] * c.radius[i]) {
+            out.push_back(c.index[i]);
+        }
+    }
+}
+
+void ShapeBatch::queryCirclevsAABB(float x, float y, float radius, std::vector<uint32_t>& out) const {
+    const AABBArrays& a = m_aabbs;
+    float radiusSq = radius * radius;
+
+#if defined(RETRO_NARROWPHASE_SIMD)
+    if (m_simdEnabled) {
+        Simd::V qx = Simd::set1(x), qy = Simd::set1(y);
+        Simd::V qRadiusSq = Simd::set1(radiusSq);
+        for (size_t i = 0; i < a.count; i += Simd::WIDTH) {
+            // Closest point on each rect to the query center
+            Simd::V closestX = Simd::max(Simd::min(qx, Simd::load(&a.maxX[i])), Simd::load(&a.minX[i]));
+            Simd::V closestY = Simd::max(Simd::min(qy, Simd::load(&a.maxY[i])), Simd::load(&a.minY[i]));
+            Simd::V dx = Simd::sub(qx, closestX);
+            Simd::V dy = Simd::sub(qy, closestY);
+            Simd::V distSq = Simd::add(Simd::mul(dx, dx), Simd::mul(dy, dy));
+
+            if (int mask = Simd::mask(Simd::le(distSq, qRadiusSq))) {
+                appendLanes(mask, i, a.index, out);
+            }
+        }
+        return;
+    }
+#endif
+
+    for (size_t i = 0; i < a.count; i++) {
+        float dx = x - std::max(a.minX[i], std::min(x, a.maxX[i]));
+        float dy = y - std::max(a.minY[i], std::min(y, a.maxY[i]));
+        if (dx * dx + dy * dy <= radiusSq) {
+            out.push_back(a.index[i]);
+        }
+    }
+}
+
+void ShapeBatch::queryCirclevsCircle(float x, float y, float radius, std::vector<uint32_t>& out) const {
+    const CircleArrays& c = m_circles;
+
+#if defined(RETRO_NARROWPHASE_SIMD)
+    if (m_simdEnabled) {
+        Simd::V qx = Simd::set1(x), qy = Simd::set1(y);
+        Simd::V qr = Simd::set1(radius);
+        for (size_t i = 0; i < c.count; i += Simd::WIDTH) {
+            Simd::V dx = Simd::sub(Simd::load(&c.x[i]), qx);
+            Simd::V dy = Simd::sub(Simd::load(&c.y[i]), qy);
+            Simd::V distSq = Simd::add(Simd::mul(dx, dx), Simd::mul(dy, dy));
+            Simd::V radiusSum = Simd::add(qr, Simd::load(&c.radius[i]));
+
+            if (int mask = Simd::mask(Simd::le(distSq, Simd::mul(radiusSum, radiusSum)))) {
+                appendLanes(mask, i, c.index, out);
+            }
+        }
+        return;
+    }
+#endif
+
+    for (size_t i = 0; i < c.count; i++) {
+        float dx = c.x[i] - x;
+        float dy = c.y[i] - y;
+        float radiusSum = radius + c.radius[i];
+        if (dx * dx + dy * dy <= radiusSum * radiusSum) {
+            out.push_back(c.index[i]);
+        }
+    }
+}
+
+} // namespace engine
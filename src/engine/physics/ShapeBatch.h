@@ -0,0 +1,108 @@
+/**
+ * @file ShapeBatch.h
+ * @brief Structure-of-arrays batch narrowphase for AABBShape/CircleShape
+ */
+#pragma once
+
+#include "CollisionShape.h"
+#include <vector>
+#include <cstdint>
+
+namespace engine {
+
+/**
+ * @brief Tests one shape against many AABBs and circles at once
+ *
+ * The virtual CollisionShape::overlaps() path dispatches per pair and
+ * reads integer SDL_Rects. ShapeBatch copies AABBs and circles into float
+ * arrays (one array per component) so a query runs as a straight loop over
+ * 4 (SSE2) or 8 (AVX) shapes per iteration. Results match overlaps():
+ * - AABB vs AABB: strict, like SDL_HasIntersection (touching edges and
+ *   empty rects don't overlap)
+ * - Anything vs circle: closest point, distance <= radius
+ *
+ * Polygons are not stored (the legacy path never reports them either);
+ * add() returns INVALID_INDEX for them.
+ *
+ * Usage:
+ *   ShapeBatch batch;
+ *   for (auto& shape : shapes) batch.add(*shape);
+ *   std::vector<uint32_t> hits;
+ *   batch.query(playerShape, hits);   // Indices in add() order
+ *
+ * Define RETRO_NARROWPHASE_SCALAR to build without the SIMD kernels.
+ *
+ * @par Thread Safety
+ * Queries are const and may run concurrently; add()/clear() may not.
+ */
+class ShapeBatch {
+public:
+    static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+    ShapeBatch() = default;
+
+    /** @brief Drop all shapes, keeps capacity */
+    void clear();
+
+    /** @brief Reserve capacity for the given number of AABBs and circles */
+    void reserve(size_t aabbCount, size_t circleCount);
+
+    /**
+     * @brief Add a shape
+     * @return Shape index reported by queries, or INVALID_INDEX for polygons
+     */
+    uint32_t add(const CollisionShape& shape);
+    uint32_t addAABB(const SDL_Rect& rect);
+    uint32_t addCircle(const Vec2& center, float radius);
+
+    /** @brief Shapes added since the last clear() (polygons excluded) */
+    uint32_t getShapeCount() const { return m_shapeCount; }
+
+    /**
+     * @brief Append the index of every stored shape that overlaps the query
+     *
+     * AABB hits are appended before circle hits, each group in add() order.
+     * @return Number of indices appended
+     */
+    int query(const CollisionShape& shape, std::vector<uint32_t>& out) const;
+    int queryAABB(const SDL_Rect& rect, std::vector<uint32_t>& out) const;
+    int queryCircle(const Vec2& center, float radius, std::vector<uint32_t>& out) const;
+
+    /** @brief Use the SIMD kernels when compiled in (default on) */
+    void setSimdEnabled(bool enabled) { m_simdEnabled = enabled; }
+    bool isSimdEnabled() const { return m_simdEnabled; }
+
+    /** @brief Widest kernel compiled in: "avx", "sse2" or "scalar" */
+    static const char* getSimdLevel();
+
+private:
+    // Arrays are padded to a multiple of SIMD_WIDTH with NaN so the kernels
+    // never need a scalar tail; NaN lanes fail every comparison
+    static constexpr size_t SIMD_WIDTH = 8;
+
+    struct AABBArrays {
+        std::vector<float> minX, minY, maxX, maxY;
+        std::vector<uint32_t> index;
+        size_t count = 0;
+    };
+
+    struct CircleArrays {
+        std::vector<float> x, y, radius;
+        std::vector<uint32_t> index;
+        size_t count = 0;
+    };
+
+    static void pad(std::vector<float>& values, size_t count);
+
+    void queryAABBvsAABB(float minX, float minY, float maxX, float maxY, std::vector<uint32_t>& out) const;
+    void queryAABBvsCircle(float minX, float minY, float maxX, float maxY, std::vector<uint32_t>& out) const;
+    void queryCirclevsAABB(float x, float y, float radius, std::vector<uint32_t>& out) const;
+    void queryCirclevsCircle(float x, float y, float radius, std::vector<uint32_t>& out) const;
+
+    AABBArrays m_aabbs;
+    CircleArrays m_circles;
+    uint32_t m_shapeCount = 0;
+    bool m_simdEnabled = true;
+};
+
+} // namespace engine
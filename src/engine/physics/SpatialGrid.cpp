@@ -4,97 +4,273 @@
  */
 #include "SpatialGrid.h"
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace engine {
 
-SpatialGrid::SpatialGrid(int cellSize) : m_cellSize(cellSize) {}
+namespace {
+
+int64_t floorDiv(int64_t value, int64_t divisor) {
+    int64_t q = value / divisor;
+    if ((value % divisor != 0) && (value < 0)) {
+        --q;
+    }
+    return q;
+}
+
+int roundUpToPowerOfTwo(int value) {
+    int result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+} // namespace
+
+SpatialGrid::SpatialGrid(int cellSize, int gridDimension)
+    : m_cellSize(std::max(cellSize, 1))
+    , m_dimension(roundUpToPowerOfTwo(std::max(gridDimension, 1)))
+    , m_dimensionMask(m_dimension - 1)
+{
+    m_buckets.resize(static_cast<size_t>(m_dimension) * m_dimension);
+}
 
 void SpatialGrid::clear() {
-    m_grid.clear();
-}
-
-int SpatialGrid::getCellKey(int x, int y) const {
-    // Simple hash for grid coordinates
-    return (x << 16) | (y & 0xFFFF);
-}
-
-void SpatialGrid::getCellsForBody(const PhysicsBody* body, std::vector<int>& cells) const {
-    if (!body || body->getShapes().empty()) return;
-    
-    // Get bounding box from first shape
-    SDL_Rect bounds = body->getShapes()[0]->getBounds();
-    
-    // Calculate grid cells
-    int minX = bounds.x / m_cellSize;
-    int minY = bounds.y / m_cellSize;
-    int maxX = (bounds.x + bounds.w) / m_cellSize;
-    int maxY = (bounds.y + bounds.h) / m_cellSize;
-    
-    for (int y = minY; y <= maxY; y++) {
-        for (int x = minX; x <= maxX; x++) {
-            cells.push_back(getCellKey(x, y));
-        }
+    for (auto& bucket : m_buckets) {
+        bucket.clear();
     }
+    m_proxies.clear();
+    clearBodies();
+    m_freeList = NULL_PROXY;
+    m_proxyCount = 0;
 }
 
-void SpatialGrid::insert(PhysicsBody* body) {
-    if (!body) return;
-    
-    std::vector<int> cells;
-    getCellsForBody(body, cells);
-    
-    for (int cellKey : cells) {
-        m_grid[cellKey].push_back(body);
+// ═══════════════════════════════════════════════════════════════════════════
+// CELLS
+// ═══════════════════════════════════════════════════════════════════════════
+
+SpatialGrid::CellRange SpatialGrid::getCellRange(const SDL_Rect& bounds) const {
+    CellRange range;
+    int64_t right = static_cast<int64_t>(bounds.x) + std::max(bounds.w, 0);
+    int64_t bottom = static_cast<int64_t>(bounds.y) + std::max(bounds.h, 0);
+
+    range.minX = floorDiv(bounds.x, m_cellSize);
+    range.minY = floorDiv(bounds.y, m_cellSize);
+    range.maxX = floorDiv(right, m_cellSize);
+    range.maxY = floorDiv(bottom, m_cellSize);
+
+    // A range wider than the grid would visit buckets twice
+    if (range.maxX - range.minX >= m_dimension) {
+        range.maxX = range.minX + m_dimension - 1;
+        range.clamped = true;
     }
+    if (range.maxY - range.minY >= m_dimension) {
+        range.maxY = range.minY + m_dimension - 1;
+        range.clamped = true;
+    }
+    return range;
 }
 
-std::vector<PhysicsBody*> SpatialGrid::query(const PhysicsBody* body) const {
-    std::vector<PhysicsBody*> result;
-    if (!body) return result;
-    
-    std::vector<int> cells;
-    getCellsForBody(body, cells);
-    
-    for (int cellKey : cells) {
-        auto it = m_grid.find(cellKey);
-        if (it != m_grid.end()) {
-            for (PhysicsBody* other : it->second) {
-                if (other != body) {
-                    // Avoid duplicates
-                    if (std::find(result.begin(), result.end(), other) == result.end()) {
-                        result.push_back(other);
-                    }
-                }
+int SpatialGrid::getBucketIndex(int64_t cellX, int64_t cellY) const {
+    // Two's complement masking wraps negative cells correctly
+    int bx = static_cast<int>(cellX & m_dimensionMask);
+    int by = static_cast<int>(cellY & m_dimensionMask);
+    return by * m_dimension + bx;
+}
+
+void SpatialGrid::addToCells(ProxyId proxyId, const CellRange& range, const CellRange* skip) {
+    for (int64_t y = range.minY; y <= range.maxY; y++) {
+        for (int64_t x = range.minX; x <= range.maxX; x++) {
+            if (skip && skip->contains(x, y)) continue;
+            m_buckets[getBucketIndex(x, y)].push_back(proxyId);
+        }
+    }
+}
+
+void SpatialGrid::removeFromCells(ProxyId proxyId, const CellRange& range, const CellRange* skip) {
+    for (int64_t y = range.minY; y <= range.maxY; y++) {
+        for (int64_t x = range.minX; x <= range.maxX; x++) {
+            if (skip && skip->contains(x, y)) continue;
+            auto& bucket = m_buckets[getBucketIndex(x, y)];
+            auto it = std::find(bucket.begin(), bucket.end(), proxyId);
+            if (it != bucket.end()) {
+                *it = bucket.back();
+                bucket.pop_back();
             }
         }
     }
-    
-    return result;
 }
 
-std::vector<PhysicsBody*> SpatialGrid::queryRect(const SDL_Rect& rect) const {
-    std::vector<PhysicsBody*> result;
-    
-    int minX = rect.x / m_cellSize;
-    int minY = rect.y / m_cellSize;
-    int maxX = (rect.x + rect.w) / m_cellSize;
-    int maxY = (rect.y + rect.h) / m_cellSize;
-    
-    for (int y = minY; y <= maxY; y++) {
-        for (int x = minX; x <= maxX; x++) {
-            int cellKey = getCellKey(x, y);
-            auto it = m_grid.find(cellKey);
-            if (it != m_grid.end()) {
-                for (PhysicsBody* body : it->second) {
-                    if (std::find(result.begin(), result.end(), body) == result.end()) {
-                        result.push_back(body);
-                    }
+uint32_t SpatialGrid::nextQueryStamp() const {
+    if (++m_queryStamp == 0) {
+        // Stamp wrapped around - reset so stale stamps can't match
+        for (const auto& proxy : m_proxies) {
+            proxy.queryStamp = 0;
+        }
+        m_queryStamp = 1;
+    }
+    return m_queryStamp;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// PROXIES
+// ═══════════════════════════════════════════════════════════════════════════
+
+SpatialGrid::ProxyId SpatialGrid::createProxy(const SDL_Rect& bounds, void* userData) {
+    ProxyId proxyId;
+    if (m_freeList != NULL_PROXY) {
+        proxyId = m_freeList;
+        m_freeList = m_proxies[proxyId].nextFree;
+    } else {
+        proxyId = static_cast<ProxyId>(m_proxies.size());
+        m_proxies.emplace_back();
+    }
+
+    Proxy& proxy = m_proxies[proxyId];
+    proxy.bounds = bounds;
+    proxy.userData = userData;
+    proxy.cells = getCellRange(bounds);
+    proxy.queryStamp = 0;
+    proxy.nextFree = NULL_PROXY;
+    proxy.alive = true;
+
+    addToCells(proxyId, proxy.cells, nullptr);
+    m_proxyCount++;
+    return proxyId;
+}
+
+void SpatialGrid::moveProxy(ProxyId proxyId, const SDL_Rect& bounds) {
+    if (proxyId < 0 || proxyId >= static_cast<ProxyId>(m_proxies.size())) return;
+    Proxy& proxy = m_proxies[proxyId];
+    if (!proxy.alive) return;
+
+    proxy.bounds = bounds;
+    CellRange newCells = getCellRange(bounds);
+    const CellRange& oldCells = proxy.cells;
+
+    if (newCells.minX == oldCells.minX && newCells.minY == oldCells.minY &&
+        newCells.maxX == oldCells.maxX && newCells.maxY == oldCells.maxY) {
+        return;
+    }
+
+    if (newCells.clamped || oldCells.clamped) {
+        removeFromCells(proxyId, oldCells, nullptr);
+        addToCells(proxyId, newCells, nullptr);
+    } else {
+        // Only touch cells the proxy left or entered
+        removeFromCells(proxyId, oldCells, &newCells);
+        addToCells(proxyId, newCells, &oldCells);
+    }
+    proxy.cells = newCells;
+}
+
+void SpatialGrid::destroyProxy(ProxyId proxyId) {
+    if (proxyId < 0 || proxyId >= static_cast<ProxyId>(m_proxies.size())) return;
+    Proxy& proxy = m_proxies[proxyId];
+    if (!proxy.alive) return;
+
+    removeFromCells(proxyId, proxy.cells, nullptr);
+    proxy.alive = false;
+    proxy.userData = nullptr;
+    proxy.nextFree = m_freeList;
+    m_freeList = proxyId;
+    m_proxyCount--;
+}
+
+void* SpatialGrid::getUserData(ProxyId proxyId) const {
+    if (proxyId < 0 || proxyId >= static_cast<ProxyId>(m_proxies.size())) return nullptr;
+    return m_proxies[proxyId].userData;
+}
+
+const SDL_Rect& SpatialGrid::getBounds(ProxyId proxyId) const {
+    static const SDL_Rect EMPTY{0, 0, 0, 0};
+    if (proxyId < 0 || proxyId >= static_cast<ProxyId>(m_proxies.size())) return EMPTY;
+    return m_proxies[proxyId].bounds;
+}
+
+void SpatialGrid::queryRect(const SDL_Rect& rect, std::vector<ProxyId>& out) const {
+    uint32_t stamp = nextQueryStamp();
+    CellRange range = getCellRange(rect);
+
+    for (int64_t y = range.minY; y <= range.maxY; y++) {
+        for (int64_t x = range.minX; x <= range.maxX; x++) {
+            for (ProxyId proxyId : m_buckets[getBucketIndex(x, y)]) {
+                const Proxy& proxy = m_proxies[proxyId];
+                if (proxy.queryStamp == stamp) continue;
+                proxy.queryStamp = stamp;
+
+                if (rectsOverlap(proxy.bounds, rect)) {
+                    out.push_back(proxyId);
                 }
             }
         }
     }
-    
-    return result;
+}
+
+void SpatialGrid::queryPoint(const Vec2& point, std::vector<ProxyId>& out) const {
+    int64_t cellX = static_cast<int64_t>(std::floor(point.x / static_cast<float>(m_cellSize)));
+    int64_t cellY = static_cast<int64_t>(std::floor(point.y / static_cast<float>(m_cellSize)));
+
+    for (ProxyId proxyId : m_buckets[getBucketIndex(cellX, cellY)]) {
+        if (rectContains(m_proxies[proxyId].bounds, point)) {
+            out.push_back(proxyId);
+        }
+    }
+}
+
+void SpatialGrid::visitBucket(int64_t cellX, int64_t cellY, uint32_t stamp,
+                              const Vec2& start, const Vec2& end, std::vector<ProxyId>& out) const {
+    for (ProxyId proxyId : m_buckets[getBucketIndex(cellX, cellY)]) {
+        const Proxy& proxy = m_proxies[proxyId];
+        if (proxy.queryStamp == stamp) continue;
+        proxy.queryStamp = stamp;
+
+        if (segmentOverlapsRect(start, end, proxy.bounds)) {
+            out.push_back(proxyId);
+        }
+    }
+}
+
+void SpatialGrid::queryRay(const Vec2& start, const Vec2& end, std::vector<ProxyId>& out) const {
+    uint32_t stamp = nextQueryStamp();
+    const double cellSize = static_cast<double>(m_cellSize);
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    int64_t cellX = static_cast<int64_t>(std::floor(start.x / cellSize));
+    int64_t cellY = static_cast<int64_t>(std::floor(start.y / cellSize));
+    int64_t endCellX = static_cast<int64_t>(std::floor(end.x / cellSize));
+    int64_t endCellY = static_cast<int64_t>(std::floor(end.y / cellSize));
+
+    double dx = static_cast<double>(end.x) - start.x;
+    double dy = static_cast<double>(end.y) - start.y;
+    int stepX = (dx > 0.0) ? 1 : ((dx < 0.0) ? -1 : 0);
+    int stepY = (dy > 0.0) ? 1 : ((dy < 0.0) ? -1 : 0);
+
+    // Amanatides-Woo traversal: t is the fraction along the segment
+    double tDeltaX = stepX != 0 ? cellSize / std::abs(dx) : infinity;
+    double tDeltaY = stepY != 0 ? cellSize / std::abs(dy) : infinity;
+    double tMaxX = infinity;
+    double tMaxY = infinity;
+    if (stepX > 0) tMaxX = ((cellX + 1) * cellSize - start.x) / dx;
+    if (stepX < 0) tMaxX = (cellX * cellSize - start.x) / dx;
+    if (stepY > 0) tMaxY = ((cellY + 1) * cellSize - start.y) / dy;
+    if (stepY < 0) tMaxY = (cellY * cellSize - start.y) / dy;
+
+    visitBucket(cellX, cellY, stamp, start, end, out);
+
+    int64_t remaining = std::abs(endCellX - cellX) + std::abs(endCellY - cellY);
+    for (int64_t i = 0; i < remaining; i++) {
+        if (tMaxX < tMaxY) {
+            cellX += stepX;
+            tMaxX += tDeltaX;
+        } else {
+            cellY += stepY;
+            tMaxY += tDeltaY;
+        }
+        visitBucket(cellX, cellY, stamp, start, end, out);
+    }
 }
 
 } // namespace engine
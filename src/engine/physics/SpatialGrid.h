@@ -4,39 +4,101 @@
  */
 #pragma once
 
-#include "CollisionShape.h"
-#include "PhysicsBody.h"
+#include "IBroadPhase.h"
 #include <vector>
-#include <unordered_map>
+#include <cstdint>
 
 namespace engine {
 
 /**
- * @brief Grid-based spatial partitioning for broad phase collision
+ * @brief Incremental uniform grid for broad phase collision
+ *
+ * Cells are stored in a flat, power-of-two sized bucket array. World cell
+ * coordinates wrap into the buckets, so negative and arbitrarily large
+ * coordinates work without key collisions corrupting results (aliased
+ * entries are rejected by the bounds test in every query).
+ *
+ * Each entry is a proxy with its own bounds and user data. move() only
+ * touches the cells the proxy entered or left, so static and slow bodies
+ * cost nothing after insertion.
+ *
+ * @par Thread Safety
+ * Not thread-safe. Queries use an internal stamp for deduplication.
  */
-class SpatialGrid {
+class SpatialGrid : public IBroadPhase {
 public:
-    SpatialGrid(int cellSize = 64);
-    ~SpatialGrid() = default;
-    
-    /** @brief Clear all bodies from grid */
-    void clear();
-    
-    /** @brief Insert body into grid */
-    void insert(PhysicsBody* body);
-    
-    /** @brief Get potential collision candidates for a body */
-    std::vector<PhysicsBody*> query(const PhysicsBody* body) const;
-    
-    /** @brief Get all bodies in a rectangular area */
-    std::vector<PhysicsBody*> queryRect(const SDL_Rect& rect) const;
-    
+    using IBroadPhase::queryRect;
+
+    /**
+     * @param cellSize Cell size in pixels
+     * @param gridDimension Buckets per axis (rounded up to a power of two)
+     */
+    SpatialGrid(int cellSize = 64, int gridDimension = 128);
+    ~SpatialGrid() override = default;
+
+    /** @brief Clear all proxies from grid */
+    void clear() override;
+
+    // ═══════════════════════════════════════════════════════════════════
+    // PROXIES
+    // ═══════════════════════════════════════════════════════════════════
+
+    ProxyId createProxy(const SDL_Rect& bounds, void* userData) override;
+
+    /** @brief Update proxy bounds, only changed cells are touched */
+    void moveProxy(ProxyId proxyId, const SDL_Rect& bounds) override;
+
+    void destroyProxy(ProxyId proxyId) override;
+
+    void* getUserData(ProxyId proxyId) const override;
+    const SDL_Rect& getBounds(ProxyId proxyId) const override;
+    int getProxyCount() const override { return m_proxyCount; }
+
+    // ═══════════════════════════════════════════════════════════════════
+    // QUERIES
+    // ═══════════════════════════════════════════════════════════════════
+
+    void queryRect(const SDL_Rect& rect, std::vector<ProxyId>& out) const override;
+    void queryPoint(const Vec2& point, std::vector<ProxyId>& out) const override;
+
+    /** @brief Walks only the cells the segment passes through (DDA) */
+    void queryRay(const Vec2& start, const Vec2& end, std::vector<ProxyId>& out) const override;
+
 private:
-    int getCellKey(int x, int y) const;
-    void getCellsForBody(const PhysicsBody* body, std::vector<int>& cells) const;
-    
+    struct CellRange {
+        int64_t minX = 0, minY = 0, maxX = -1, maxY = -1;
+        bool clamped = false;   ///< Wider than the grid, covers every bucket
+        bool contains(int64_t x, int64_t y) const {
+            return x >= minX && x <= maxX && y >= minY && y <= maxY;
+        }
+    };
+
+    struct Proxy {
+        SDL_Rect bounds{0, 0, 0, 0};
+        void* userData = nullptr;
+        CellRange cells;
+        mutable uint32_t queryStamp = 0;
+        ProxyId nextFree = NULL_PROXY;
+        bool alive = false;
+    };
+
+    CellRange getCellRange(const SDL_Rect& bounds) const;
+    int getBucketIndex(int64_t cellX, int64_t cellY) const;
+    void addToCells(ProxyId proxyId, const CellRange& range, const CellRange* skip);
+    void removeFromCells(ProxyId proxyId, const CellRange& range, const CellRange* skip);
+    uint32_t nextQueryStamp() const;
+    void visitBucket(int64_t cellX, int64_t cellY, uint32_t stamp,
+                     const Vec2& start, const Vec2& end, std::vector<ProxyId>& out) const;
+
     int m_cellSize;
-    std::unordered_map<int, std::vector<PhysicsBody*>> m_grid;
+    int m_dimension;
+    int m_dimensionMask;
+
+    std::vector<std::vector<ProxyId>> m_buckets;
+    std::vector<Proxy> m_proxies;
+    ProxyId m_freeList = NULL_PROXY;
+    int m_proxyCount = 0;
+    mutable uint32_t m_queryStamp = 0;
 };
 
 } // namespace engine
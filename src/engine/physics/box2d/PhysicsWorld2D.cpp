@@ -4,7 +4,11 @@
  */
 #include "PhysicsWorld2D.h"
 #include "PhysicsConversions.h"
+#include "engine/core/ActorObject.h"
+#include "engine/utils/TaskScheduler.h"
 #include <SDL.h>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 namespace engine {
@@ -27,7 +31,7 @@ PhysicsWorld2D::~PhysicsWorld2D() {
 // LIFECYCLE
 // ============================================================================
 
-void PhysicsWorld2D::initialize(glm::vec2 gravity) {
+void PhysicsWorld2D::initialize(glm::vec2 gravity, int workerCount) {
     if (m_initialized) {
         return;
     }
@@ -35,11 +39,41 @@ void PhysicsWorld2D::initialize(glm::vec2 gravity) {
     b2WorldDef worldDef = b2DefaultWorldDef();
     worldDef.gravity = toBox2D(gravity);
     
+    if (workerCount <= 0) {
+        workerCount = TaskScheduler::getHardwareWorkerCount();
+    }
+    if (workerCount > 1) {
+        m_scheduler = TaskScheduler::acquireShared(workerCount);
+        worldDef.workerCount = m_scheduler->getWorkerCount();
+        worldDef.enqueueTask = &PhysicsWorld2D::enqueueTask;
+        worldDef.finishTask = &PhysicsWorld2D::finishTask;
+        worldDef.userTaskContext = m_scheduler.get();
+    }
+    
     m_worldId = b2CreateWorld(&worldDef);
     m_initialized = true;
     
     std::cout << "[PhysicsWorld2D] Initialized with gravity (" 
-              << gravity.x << ", " << gravity.y << ") pixels/s²" << std::endl;
+              << gravity.x << ", " << gravity.y << ") pixels/s², "
+              << getWorkerCount() << " worker(s)" << std::endl;
+}
+
+void* PhysicsWorld2D::enqueueTask(b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext) {
+    auto* scheduler = static_cast<TaskScheduler*>(userContext);
+    // nullptr tells Box2D the work already ran inline (nested call only)
+    return scheduler->parallelFor(itemCount, minRange,
+        [task, taskContext](int start, int end, int workerIndex) {
+            task(start, end, static_cast<uint32_t>(workerIndex), taskContext);
+        });
+}
+
+void PhysicsWorld2D::finishTask(void* userTask, void* userContext) {
+    auto* scheduler = static_cast<TaskScheduler*>(userContext);
+    scheduler->wait(static_cast<TaskScheduler::Task*>(userTask));
+}
+
+int PhysicsWorld2D::getWorkerCount() const {
+    return m_scheduler ? m_scheduler->getWorkerCount() : 1;
 }
 
 void PhysicsWorld2D::shutdown() {
@@ -49,10 +83,20 @@ void PhysicsWorld2D::shutdown() {
     
     // Clear tracked bodies
     m_bodies.clear();
+    m_bodyStates.clear();
+    m_movedBodies.clear();
+    m_sensorSlots.clear();
+    m_preStepCallbacks.clear();
+    m_addedPreStepCallbacks.clear();
+    m_accumulator = 0.0f;
+    m_interpolationAlpha = 0.0f;
+    m_stepsLastFrame = 0;
+    m_stepCount = 0;
     
-    // Destroy world
+    // Destroy world (before its worker pool)
     b2DestroyWorld(m_worldId);
     m_worldId = b2_nullWorldId;
+    m_scheduler.reset();
     m_initialized = false;
     
     std::cout << "[PhysicsWorld2D] Shutdown complete" << std::endl;
@@ -61,12 +105,128 @@ void PhysicsWorld2D::shutdown() {
 void PhysicsWorld2D::step(float deltaTime) {
     if (!m_initialized) return;
     
-    // Box2D recommends fixed timestep, but we'll use variable for now
-    // Clamp deltaTime to prevent spiral of death
-    float clampedDt = std::min(deltaTime, 1.0f / 30.0f);
+    const float fixedDt = m_stepSettings.fixedTimeStep;
+    m_accumulator += std::max(deltaTime, 0.0f);
+    m_stepsLastFrame = 0;
+    
+    // Keep the previous moved list on frames without a step - those bodies
+    // still need their interpolated pose refreshed
+    if (m_accumulator >= fixedDt) {
+        m_movedBodies.clear();
+        m_movedFrame++;
+    }
+    m_frameProfile = StepProfile2D{};
+    m_frameProfile.workerCount = getWorkerCount();
+    
+    while (m_accumulator >= fixedDt && m_stepsLastFrame < m_stepSettings.maxStepsPerFrame) {
+        fixedStep(fixedDt);
+        m_accumulator -= fixedDt;
+        m_stepsLastFrame++;
+    }
+    
+    // Too far behind (breakpoint, hitch) - drop the backlog instead of
+    // trying to catch up and falling further behind every frame
+    if (m_accumulator >= fixedDt) {
+        m_accumulator = std::fmod(m_accumulator, fixedDt);
+    }
+    
+    m_interpolationAlpha = m_stepSettings.interpolate ? m_accumulator / fixedDt : 1.0f;
+    
+    syncMovedActors();
+}
+
+void PhysicsWorld2D::fixedStep(float dt) {
+    // Callbacks may add or remove callbacks - both are deferred until the
+    // loop is done, so the vector isn't reallocated or shifted under it
+    m_runningPreStepCallbacks = true;
+    for (const auto& [id, callback] : m_preStepCallbacks) {
+        if (id != 0) callback(dt);
+    }
+    m_runningPreStepCallbacks = false;
+    
+    m_preStepCallbacks.erase(std::remove_if(m_preStepCallbacks.begin(), m_preStepCallbacks.end(),
+        [](const auto& entry) { return entry.first == 0; }), m_preStepCallbacks.end());
+    for (auto& entry : m_addedPreStepCallbacks) {
+        m_preStepCallbacks.push_back(std::move(entry));
+    }
+    m_addedPreStepCallbacks.clear();
+    
+    b2World_Step(m_worldId, dt, m_stepSettings.subStepCount);
+    m_stepCount++;
+    updateProfile();
+    
+    // Move events first - they become invalid once a sensor callback
+    // destroys a body
+    processBodyMoveEvents();
+    processSensorEvents();
+}
+
+void PhysicsWorld2D::updateProfile() {
+    b2Profile profile = b2World_GetProfile(m_worldId);
+    
+    StepProfile2D& p = m_lastStepProfile;
+    p.step = profile.step;
+    p.pairs = profile.pairs;
+    p.collide = profile.collide;
+    p.solve = profile.solve;
+    p.solveConstraints = profile.solveConstraints;
+    p.integratePositions = profile.integratePositions;
+    p.transforms = profile.transforms;
+    p.refit = profile.refit;
+    p.sleepIslands = profile.sleepIslands;
+    p.sensors = profile.sensors;
+    p.stepCount = 1;
+    p.workerCount = getWorkerCount();
     
-    b2World_Step(m_worldId, clampedDt, defaults::VELOCITY_ITERATIONS);
+    m_frameProfile.add(p);
+}
+
+void StepProfile2D::add(const StepProfile2D& other) {
+    step += other.step;
+    pairs += other.pairs;
+    collide += other.collide;
+    solve += other.solve;
+    solveConstraints += other.solveConstraints;
+    integratePositions += other.integratePositions;
+    transforms += other.transforms;
+    refit += other.refit;
+    sleepIslands += other.sleepIslands;
+    sensors += other.sensors;
+    stepCount += other.stepCount;
+}
+
+void PhysicsWorld2D::processBodyMoveEvents() {
+    b2BodyEvents events = b2World_GetBodyEvents(m_worldId);
     
+    for (int i = 0; i < events.moveCount; i++) {
+        const b2BodyMoveEvent& event = events.moveEvents[i];
+        
+        BodyState* state = findBodyState(event.bodyId);
+        if (!state) continue;
+        
+        state->previous = state->current;
+        state->current = event.transform;
+        state->movedStep = m_stepCount;
+        
+        if (state->listedFrame != m_movedFrame) {
+            state->listedFrame = m_movedFrame;
+            ActorObject* actor = state->syncActor ? static_cast<ActorObject*>(event.userData) : nullptr;
+            m_movedBodies.push_back({event.bodyId, actor});
+        }
+    }
+}
+
+void PhysicsWorld2D::syncMovedActors() {
+    for (const MovedBody& moved : m_movedBodies) {
+        // Skip bodies destroyed since (e.g. by a sensor callback)
+        if (!moved.actor || !findBodyState(moved.bodyId)) continue;
+        
+        glm::vec2 pos = getInterpolatedPosition(moved.bodyId);
+        moved.actor->setPosition(Vec2(pos.x, pos.y));
+    }
+}
+
+void PhysicsWorld2D::processSensorEvents() {
     // Process sensor events (triggers)
     b2SensorEvents sensorEvents = b2World_GetSensorEvents(m_worldId);
     
@@ -85,14 +245,20 @@ void PhysicsWorld2D::step(float deltaTime) {
             info.isSensorContact = true;
             onContactBegin(info);
         }
+        
+        if (SensorListener2D* listener = findSensorListener(event->sensorShapeId)) {
+            listener->onSensorBegin(event->visitorShapeId, static_cast<ActorObject*>(visitorUserData));
+        }
     }
     
-    // Handle sensor end events
+    // Handle sensor end events - either shape may have been destroyed since
     for (int i = 0; i < sensorEvents.endCount; i++) {
         b2SensorEndTouchEvent* event = sensorEvents.endEvents + i;
+        if (!b2Shape_IsValid(event->sensorShapeId)) continue;
         
         void* sensorUserData = b2Shape_GetUserData(event->sensorShapeId);
-        void* visitorUserData = b2Shape_GetUserData(event->visitorShapeId);
+        void* visitorUserData = b2Shape_IsValid(event->visitorShapeId)
+            ? b2Shape_GetUserData(event->visitorShapeId) : nullptr;
         
         if (sensorUserData && visitorUserData && onContactEnd) {
             ContactInfo info;
@@ -101,6 +267,88 @@ void PhysicsWorld2D::step(float deltaTime) {
             info.isSensorContact = true;
             onContactEnd(info);
         }
+        
+        if (SensorListener2D* listener = findSensorListener(event->sensorShapeId)) {
+            listener->onSensorEnd(event->visitorShapeId, static_cast<ActorObject*>(visitorUserData));
+        }
+    }
+}
+
+void PhysicsWorld2D::setSensorListener(b2ShapeId sensorShapeId, SensorListener2D* listener) {
+    if (!m_initialized || !b2Shape_IsValid(sensorShapeId)) return;
+    
+    size_t index = static_cast<size_t>(sensorShapeId.index1);
+    if (index >= m_sensorSlots.size()) {
+        if (!listener) return;
+        m_sensorSlots.resize(index + 1);
+    }
+    
+    SensorSlot& slot = m_sensorSlots[index];
+    slot.shapeId = listener ? sensorShapeId : b2_nullShapeId;
+    slot.listener = listener;
+}
+
+SensorListener2D* PhysicsWorld2D::findSensorListener(b2ShapeId shapeId) const {
+    size_t index = static_cast<size_t>(shapeId.index1);
+    if (index >= m_sensorSlots.size()) return nullptr;
+    
+    const SensorSlot& slot = m_sensorSlots[index];
+    return B2_ID_EQUALS(slot.shapeId, shapeId) ? slot.listener : nullptr;
+}
+
+void PhysicsWorld2D::clearSensorListeners(b2BodyId bodyId) {
+    if (m_sensorSlots.empty()) return;
+    
+    int shapeCount = b2Body_GetShapeCount(bodyId);
+    if (shapeCount <= 0) return;
+    
+    std::vector<b2ShapeId> shapes(static_cast<size_t>(shapeCount));
+    b2Body_GetShapes(bodyId, shapes.data(), shapeCount);
+    for (b2ShapeId shapeId : shapes) {
+        size_t index = static_cast<size_t>(shapeId.index1);
+        if (index < m_sensorSlots.size() && B2_ID_EQUALS(m_sensorSlots[index].shapeId, shapeId)) {
+            m_sensorSlots[index] = SensorSlot{};
+        }
+    }
+}
+
+// ============================================================================
+// FIXED TIMESTEP
+// ============================================================================
+
+void PhysicsWorld2D::setStepSettings(const StepSettings2D& settings) {
+    m_stepSettings = settings;
+    m_stepSettings.fixedTimeStep = std::max(settings.fixedTimeStep, 1.0f / 1000.0f);
+    m_stepSettings.subStepCount = std::max(settings.subStepCount, 1);
+    m_stepSettings.maxStepsPerFrame = std::max(settings.maxStepsPerFrame, 1);
+}
+
+PhysicsWorld2D::StepCallbackId PhysicsWorld2D::addPreStepCallback(std::function<void(float)> callback) {
+    StepCallbackId id = m_nextStepCallbackId++;
+    auto& callbacks = m_runningPreStepCallbacks ? m_addedPreStepCallbacks : m_preStepCallbacks;
+    callbacks.emplace_back(id, std::move(callback));
+    return id;
+}
+
+void PhysicsWorld2D::removePreStepCallback(StepCallbackId id) {
+    if (id == 0) return;
+    
+    auto matches = [id](const auto& entry) { return entry.first == id; };
+    auto added = std::find_if(m_addedPreStepCallbacks.begin(), m_addedPreStepCallbacks.end(), matches);
+    if (added != m_addedPreStepCallbacks.end()) {
+        m_addedPreStepCallbacks.erase(added);
+        return;
+    }
+    
+    auto it = std::find_if(m_preStepCallbacks.begin(), m_preStepCallbacks.end(), matches);
+    if (it == m_preStepCallbacks.end()) return;
+    
+    // Inside fixedStep() the entry (maybe the running callback) is only
+    // marked; it's erased once every callback has run
+    if (m_runningPreStepCallbacks) {
+        it->first = 0;
+    } else {
+        m_preStepCallbacks.erase(it);
     }
 }
 
@@ -154,6 +402,21 @@ b2BodyId PhysicsWorld2D::createBody(const BodyDef2D& def) {
     b2BodyId bodyId = b2CreateBody(m_worldId, &bodyDef);
     m_bodies.push_back(bodyId);
     
+    // Static bodies never report moves, so they need no state
+    if (def.type != BodyType2D::Static) {
+        size_t index = static_cast<size_t>(bodyId.index1);
+        if (index >= m_bodyStates.size()) {
+            m_bodyStates.resize(index + 1);
+        }
+        
+        BodyState& state = m_bodyStates[index];
+        state = BodyState{};
+        state.bodyId = bodyId;
+        state.current = b2Body_GetTransform(bodyId);
+        state.previous = state.current;
+        state.syncActor = def.syncActor && def.userData;
+    }
+    
     return bodyId;
 }
 
@@ -161,6 +424,10 @@ void PhysicsWorld2D::destroyBody(b2BodyId bodyId) {
     if (!m_initialized) return;
     if (!b2Body_IsValid(bodyId)) return;
     
+    if (BodyState* state = findBodyState(bodyId)) {
+        *state = BodyState{};
+    }
+    clearSensorListeners(bodyId);
     b2DestroyBody(bodyId);
     
     // Remove from tracking
@@ -223,6 +490,7 @@ b2ShapeId PhysicsWorld2D::addShape(b2BodyId bodyId, const ShapeDef2D& def) {
 void PhysicsWorld2D::removeShape(b2ShapeId shapeId) {
     if (!m_initialized) return;
     if (!b2Shape_IsValid(shapeId)) return;
+    setSensorListener(shapeId, nullptr);
     b2DestroyShape(shapeId, true); // true = update body mass
 }
 
@@ -238,6 +506,12 @@ glm::vec2 PhysicsWorld2D::getBodyPosition(b2BodyId bodyId) const {
 void PhysicsWorld2D::setBodyPosition(b2BodyId bodyId, glm::vec2 position) {
     if (!b2Body_IsValid(bodyId)) return;
     b2Body_SetTransform(bodyId, toBox2D(position), b2Body_GetRotation(bodyId));
+    
+    // Teleport - don't blend from the old position
+    if (BodyState* state = findBodyState(bodyId)) {
+        state->current = b2Body_GetTransform(bodyId);
+        state->previous = state->current;
+    }
 }
 
 float PhysicsWorld2D::getBodyAngle(b2BodyId bodyId) const {
@@ -248,6 +522,28 @@ float PhysicsWorld2D::getBodyAngle(b2BodyId bodyId) const {
 void PhysicsWorld2D::setBodyAngle(b2BodyId bodyId, float angle) {
     if (!b2Body_IsValid(bodyId)) return;
     b2Body_SetTransform(bodyId, b2Body_GetPosition(bodyId), b2MakeRot(angle));
+    
+    if (BodyState* state = findBodyState(bodyId)) {
+        state->current = b2Body_GetTransform(bodyId);
+        state->previous = state->current;
+    }
+}
+
+void PhysicsWorld2D::setBodyEnabled(b2BodyId bodyId, bool enabled) {
+    if (!m_initialized) return;
+    if (!b2Body_IsValid(bodyId)) return;
+    if (b2Body_IsEnabled(bodyId) == enabled) return;
+    
+    if (enabled) {
+        b2Body_Enable(bodyId);
+    } else {
+        b2Body_Disable(bodyId);
+    }
+}
+
+bool PhysicsWorld2D::isBodyEnabled(b2BodyId bodyId) const {
+    if (!b2Body_IsValid(bodyId)) return false;
+    return b2Body_IsEnabled(bodyId);
 }
 
 glm::vec2 PhysicsWorld2D::getBodyVelocity(b2BodyId bodyId) const {
@@ -270,6 +566,87 @@ void PhysicsWorld2D::applyImpulse(b2BodyId bodyId, glm::vec2 impulse) {
     b2Body_ApplyLinearImpulseToCenter(bodyId, toBox2D(impulse), true);
 }
 
+void PhysicsWorld2D::captureSnapshot(WorldSnapshot2D& out) const {
+    out.clear();
+    if (!m_initialized) return;
+    
+    out.reserve(m_bodies.size());
+    for (b2BodyId bodyId : m_bodies) {
+        if (!b2Body_IsValid(bodyId)) continue;
+        
+        BodySnapshot2D body;
+        body.bodyId = bodyId;
+        body.transform = b2Body_GetTransform(bodyId);
+        body.linearVelocity = b2Body_GetLinearVelocity(bodyId);
+        body.angularVelocity = b2Body_GetAngularVelocity(bodyId);
+        body.awake = b2Body_IsAwake(bodyId);
+        out.push_back(body);
+    }
+}
+
+void PhysicsWorld2D::restoreSnapshot(const WorldSnapshot2D& snapshot) {
+    if (!m_initialized) return;
+    
+    for (const BodySnapshot2D& body : snapshot) {
+        if (!b2Body_IsValid(body.bodyId)) continue;
+        
+        b2Body_SetTransform(body.bodyId, body.transform.p, body.transform.q);
+        if (b2Body_GetType(body.bodyId) != b2_staticBody) {
+            b2Body_SetLinearVelocity(body.bodyId, body.linearVelocity);
+            b2Body_SetAngularVelocity(body.bodyId, body.angularVelocity);
+            b2Body_SetAwake(body.bodyId, body.awake);
+        }
+        
+        // Teleport - don't blend from the old position
+        if (BodyState* state = findBodyState(body.bodyId)) {
+            state->current = body.transform;
+            state->previous = body.transform;
+        }
+    }
+    
+    m_accumulator = 0.0f;
+    m_interpolationAlpha = 0.0f;
+}
+
+PhysicsWorld2D::BodyState* PhysicsWorld2D::findBodyState(b2BodyId bodyId) {
+    size_t index = static_cast<size_t>(bodyId.index1);
+    if (index >= m_bodyStates.size()) return nullptr;
+    
+    BodyState& state = m_bodyStates[index];
+    return B2_ID_EQUALS(state.bodyId, bodyId) ? &state : nullptr;
+}
+
+const PhysicsWorld2D::BodyState* PhysicsWorld2D::findBodyState(b2BodyId bodyId) const {
+    return const_cast<PhysicsWorld2D*>(this)->findBodyState(bodyId);
+}
+
+glm::vec2 PhysicsWorld2D::getInterpolatedPosition(b2BodyId bodyId) const {
+    if (!b2Body_IsValid(bodyId)) return {0, 0};
+    
+    const BodyState* state = findBodyState(bodyId);
+    if (!state) {
+        return fromBox2D(b2Body_GetPosition(bodyId));
+    }
+    // Only blend across the latest step - anything older is at rest
+    if (state->movedStep != m_stepCount) {
+        return fromBox2D(state->current.p);
+    }
+    return fromBox2D(b2Lerp(state->previous.p, state->current.p, m_interpolationAlpha));
+}
+
+float PhysicsWorld2D::getInterpolatedAngle(b2BodyId bodyId) const {
+    if (!b2Body_IsValid(bodyId)) return 0.0f;
+    
+    const BodyState* state = findBodyState(bodyId);
+    if (!state) {
+        return b2Rot_GetAngle(b2Body_GetRotation(bodyId));
+    }
+    if (state->movedStep != m_stepCount) {
+        return b2Rot_GetAngle(state->current.q);
+    }
+    return b2Rot_GetAngle(b2NLerp(state->previous.q, state->current.q, m_interpolationAlpha));
+}
+
 // ============================================================================
 // RAYCASTING
 // ============================================================================
@@ -299,6 +676,190 @@ PhysicsWorld2D::RaycastResult PhysicsWorld2D::raycast(glm::vec2 start, glm::vec2
     return result;
 }
 
+// ============================================================================
+// BATCHED QUERIES
+// ============================================================================
+
+namespace {
+
+b2QueryFilter makeQueryFilter(CollisionCategory category, CollisionCategory mask) {
+    b2QueryFilter filter = b2DefaultQueryFilter();
+    filter.categoryBits = static_cast<uint64_t>(category);
+    filter.maskBits = static_cast<uint64_t>(mask);
+    return filter;
+}
+
+/**
+ * @brief Collects cast hits for one query into its slice of the hit array
+ *
+ * Closest mode clips the cast at every hit so Box2D converges on the
+ * nearest shape. All mode keeps the nearest maxHits sorted by fraction and,
+ * once full, clips at the farthest kept hit.
+ */
+struct CastCollector {
+    QueryHit2D* hits;
+    int maxHits;
+    QueryMode2D mode;
+    QueryResult2D* result;
+    
+    static float callback(b2ShapeId shapeId, b2Vec2 point, b2Vec2 normal, float fraction, void* context) {
+        auto* self = static_cast<CastCollector*>(context);
+        return self->add(shapeId, point, normal, fraction);
+    }
+    
+    float add(b2ShapeId shapeId, b2Vec2 point, b2Vec2 normal, float fraction) {
+        QueryHit2D hit;
+        hit.shapeId = shapeId;
+        hit.point = fromBox2D(point);
+        hit.normal = glm::vec2{normal.x, normal.y};
+        hit.fraction = fraction;
+        
+        if (mode == QueryMode2D::Closest) {
+            hits[0] = hit;
+            result->hitCount = 1;
+            return fraction;
+        }
+        
+        int count = result->hitCount;
+        if (count == maxHits) {
+            result->truncated = true;
+            if (fraction >= hits[count - 1].fraction) {
+                return hits[count - 1].fraction;
+            }
+            count--; // Drop the farthest
+        }
+        
+        int i = count;
+        while (i > 0 && hits[i - 1].fraction > fraction) {
+            hits[i] = hits[i - 1];
+            i--;
+        }
+        hits[i] = hit;
+        result->hitCount = count + 1;
+        
+        return result->hitCount == maxHits ? hits[maxHits - 1].fraction : 1.0f;
+    }
+};
+
+struct OverlapCollector {
+    QueryHit2D* hits;
+    int maxHits;
+    QueryResult2D* result;
+    
+    static bool callback(b2ShapeId shapeId, void* context) {
+        auto* self = static_cast<OverlapCollector*>(context);
+        if (self->result->hitCount == self->maxHits) {
+            self->result->truncated = true;
+            return false;
+        }
+        QueryHit2D& hit = self->hits[self->result->hitCount++];
+        hit = QueryHit2D{};
+        hit.shapeId = shapeId;
+        return true;
+    }
+};
+
+b2ShapeProxy makeCastProxy(const ShapeCastQuery2D& query) {
+    b2Vec2 position = toBox2D(query.start);
+    b2Rot rotation = b2MakeRot(query.angle);
+    
+    switch (query.type) {
+        case ShapeType2D::Circle: {
+            b2Vec2 center{0.0f, 0.0f};
+            return b2MakeOffsetProxy(&center, 1, pixelsToMeters(query.size.x / 2.0f), position, rotation);
+        }
+        case ShapeType2D::Capsule: {
+            // Vertical, matching addShape()
+            float radius = pixelsToMeters(query.size.x / 2.0f);
+            float halfHeight = pixelsToMeters(query.size.y / 2.0f - query.size.x / 2.0f);
+            b2Vec2 centers[2] = {{0.0f, -halfHeight}, {0.0f, halfHeight}};
+            return b2MakeOffsetProxy(centers, 2, radius, position, rotation);
+        }
+        case ShapeType2D::Box:
+        default: {
+            float hx = pixelsToMeters(query.size.x / 2.0f);
+            float hy = pixelsToMeters(query.size.y / 2.0f);
+            b2Vec2 corners[4] = {{-hx, -hy}, {hx, -hy}, {hx, hy}, {-hx, hy}};
+            return b2MakeOffsetProxy(corners, 4, 0.0f, position, rotation);
+        }
+    }
+}
+
+} // namespace
+
+void PhysicsWorld2D::runBatch(int count, bool parallel, const std::function<void(int)>& runQuery) const {
+    if (parallel && m_scheduler) {
+        // Queries are small - hand out chunks so scheduling doesn't dominate
+        TaskScheduler::Task* task = m_scheduler->parallelFor(count, 16,
+            [&runQuery](int start, int end, int) {
+                for (int i = start; i < end; i++) {
+                    runQuery(i);
+                }
+            });
+        m_scheduler->wait(task);
+        return;
+    }
+    
+    for (int i = 0; i < count; i++) {
+        runQuery(i);
+    }
+}
+
+void PhysicsWorld2D::castRays(const RayQuery2D* queries, int count, QueryMode2D mode,
+                              QueryResult2D* results, QueryHit2D* hits, int maxHitsPerQuery,
+                              bool parallel) const {
+    if (count <= 0) return;
+    for (int i = 0; i < count; i++) results[i] = QueryResult2D{};
+    if (!m_initialized || maxHitsPerQuery <= 0) return;
+    
+    runBatch(count, parallel, [&](int i) {
+        const RayQuery2D& query = queries[i];
+        CastCollector collector{hits + i * maxHitsPerQuery, maxHitsPerQuery, mode, &results[i]};
+        
+        b2Vec2 origin = toBox2D(query.start);
+        b2World_CastRay(m_worldId, origin, b2Sub(toBox2D(query.end), origin),
+                        makeQueryFilter(query.category, query.mask),
+                        &CastCollector::callback, &collector);
+    });
+}
+
+void PhysicsWorld2D::castShapes(const ShapeCastQuery2D* queries, int count, QueryMode2D mode,
+                                QueryResult2D* results, QueryHit2D* hits, int maxHitsPerQuery,
+                                bool parallel) const {
+    if (count <= 0) return;
+    for (int i = 0; i < count; i++) results[i] = QueryResult2D{};
+    if (!m_initialized || maxHitsPerQuery <= 0) return;
+    
+    runBatch(count, parallel, [&](int i) {
+        const ShapeCastQuery2D& query = queries[i];
+        CastCollector collector{hits + i * maxHitsPerQuery, maxHitsPerQuery, mode, &results[i]};
+        
+        b2ShapeProxy proxy = makeCastProxy(query);
+        b2World_CastShape(m_worldId, &proxy, toBox2D(query.end - query.start),
+                          makeQueryFilter(query.category, query.mask),
+                          &CastCollector::callback, &collector);
+    });
+}
+
+void PhysicsWorld2D::overlapAABBs(const OverlapQuery2D* queries, int count,
+                                  QueryResult2D* results, QueryHit2D* hits, int maxHitsPerQuery,
+                                  bool parallel) const {
+    if (count <= 0) return;
+    for (int i = 0; i < count; i++) results[i] = QueryResult2D{};
+    if (!m_initialized || maxHitsPerQuery <= 0) return;
+    
+    runBatch(count, parallel, [&](int i) {
+        const OverlapQuery2D& query = queries[i];
+        OverlapCollector collector{hits + i * maxHitsPerQuery, maxHitsPerQuery, &results[i]};
+        
+        b2AABB box;
+        box.lowerBound = toBox2D(glm::min(query.min, query.max));
+        box.upperBound = toBox2D(glm::max(query.min, query.max));
+        b2World_OverlapAABB(m_worldId, box, makeQueryFilter(query.category, query.mask),
+                            &OverlapCollector::callback, &collector);
+    });
+}
+
 // ============================================================================
 // DEBUG RENDERING
 // ============================================================================
@@ -12,13 +12,14 @@
 #include <glm/glm.hpp>
 #include <vector>
 #include <functional>
-#include <unordered_map>
+#include <memory>
 
 struct SDL_Renderer;
 
 namespace engine {
 
 class ActorObject;
+class TaskScheduler;
 
 namespace physics {
 
@@ -61,6 +62,7 @@ struct BodyDef2D {
     bool fixedRotation = true;      // Prevent rotation (for characters)
     bool isBullet = false;          // Continuous collision detection
     void* userData = nullptr;       // Typically ActorObject*
+    bool syncActor = false;         // userData is an ActorObject* to move with the body
 };
 
 // ============================================================================
@@ -86,6 +88,145 @@ struct ShapeDef2D {
     CollisionCategory mask = CollisionCategory::All;
 };
 
+// ============================================================================
+// BATCHED QUERIES
+// ============================================================================
+
+enum class QueryMode2D {
+    Closest,    // At most one hit per query, the nearest
+    All         // Up to maxHitsPerQuery hits, sorted nearest first
+};
+
+/** @brief Ray from start to end (pixels) */
+struct RayQuery2D {
+    glm::vec2 start{0, 0};
+    glm::vec2 end{0, 0};
+    CollisionCategory category = CollisionCategory::All;
+    CollisionCategory mask = CollisionCategory::All;
+};
+
+/** @brief Shape swept from start to end, sized like ShapeDef2D */
+struct ShapeCastQuery2D {
+    ShapeType2D type = ShapeType2D::Box;
+    glm::vec2 size{32, 32};         // Width/height for box, diameter in x for circle
+    float angle = 0.0f;             // Radians
+    glm::vec2 start{0, 0};          // Shape center at the start of the sweep
+    glm::vec2 end{0, 0};
+    CollisionCategory category = CollisionCategory::All;
+    CollisionCategory mask = CollisionCategory::All;
+};
+
+/** @brief Axis-aligned box, fat-AABB overlap like b2World_OverlapAABB */
+struct OverlapQuery2D {
+    glm::vec2 min{0, 0};
+    glm::vec2 max{0, 0};
+    CollisionCategory category = CollisionCategory::All;
+    CollisionCategory mask = CollisionCategory::All;
+};
+
+struct QueryHit2D {
+    b2ShapeId shapeId = b2_nullShapeId;
+    glm::vec2 point{0, 0};          // Pixels (unused for overlaps)
+    glm::vec2 normal{0, 0};
+    float fraction = 0.0f;          // Along start -> end
+};
+
+/**
+ * @brief Per-query result of a batch
+ *
+ * Hits for query i live in hits[i * maxHitsPerQuery, + hitCount).
+ */
+struct QueryResult2D {
+    int hitCount = 0;
+    bool truncated = false;         // More hits existed than fit
+};
+
+// ============================================================================
+// STEP SETTINGS
+// ============================================================================
+
+/**
+ * @brief Fixed timestep configuration for PhysicsWorld2D::step
+ *
+ * Frame time is accumulated and consumed in fixedTimeStep slices, so the
+ * simulation (and anything hooked in with addPreStepCallback) runs with the
+ * same dt regardless of frame rate.
+ */
+struct StepSettings2D {
+    float fixedTimeStep = 1.0f / 60.0f; // Seconds per simulation step
+    int subStepCount = 4;               // Box2D solver substeps per step
+    int maxStepsPerFrame = 5;           // Leftover time is dropped beyond this (spiral of death guard)
+    bool interpolate = true;            // Blend poses between the last two steps for rendering
+};
+
+// ============================================================================
+// STEP PROFILE
+// ============================================================================
+
+/**
+ * @brief Timing breakdown of a simulation step, in milliseconds
+ *
+ * Mirrors the main stages of b2Profile. getFrameProfile() sums all fixed
+ * steps run by the last step() call.
+ */
+struct StepProfile2D {
+    float step = 0.0f;              // Whole b2World_Step
+    float pairs = 0.0f;             // Broadphase pair finding
+    float collide = 0.0f;           // Narrowphase contact update
+    float solve = 0.0f;             // Solver total
+    float solveConstraints = 0.0f;  // Constraint graph stages (parallel)
+    float integratePositions = 0.0f;
+    float transforms = 0.0f;        // Body transform finalize
+    float refit = 0.0f;             // Dynamic tree refit
+    float sleepIslands = 0.0f;
+    float sensors = 0.0f;
+    int stepCount = 0;              // Fixed steps included
+    int workerCount = 1;            // Workers the solver could use
+    
+    void add(const StepProfile2D& other);
+};
+
+// ============================================================================
+// SNAPSHOT
+// ============================================================================
+
+/**
+ * @brief Pose and velocity of one body
+ *
+ * A WorldSnapshot2D puts an existing world back to an earlier state
+ * without destroying and re-creating its bodies (see captureSnapshot()).
+ */
+struct BodySnapshot2D {
+    b2BodyId bodyId = b2_nullBodyId;
+    b2Transform transform = b2Transform_identity;
+    b2Vec2 linearVelocity = b2Vec2_zero;
+    float angularVelocity = 0.0f;
+    bool awake = true;
+};
+
+using WorldSnapshot2D = std::vector<BodySnapshot2D>;
+
+// ============================================================================
+// SENSOR LISTENERS
+// ============================================================================
+
+/**
+ * @brief Receives begin/end events for the sensor shapes it's registered on
+ *
+ * Registered per shape with PhysicsWorld2D::setSensorListener(). Events are
+ * routed through a table indexed by shape id, so dispatch doesn't look up
+ * components. visitor is the visiting shape's userData as an actor.
+ *
+ * End events also arrive when the visiting shape was destroyed; visitor is
+ * nullptr then, so listeners must match the end to its begin by visitorShape.
+ */
+class SensorListener2D {
+public:
+    virtual ~SensorListener2D() = default;
+    virtual void onSensorBegin(b2ShapeId visitorShape, ActorObject* visitor) = 0;
+    virtual void onSensorEnd(b2ShapeId visitorShape, ActorObject* visitor) = 0;
+};
+
 // ============================================================================
 // PHYSICS WORLD 2D
 // ============================================================================
@@ -106,10 +247,67 @@ public:
     // LIFECYCLE
     // ========================================================================
     
-    void initialize(glm::vec2 gravity = {0.0f, 980.0f});
+    /**
+     * @param gravity Pixels/s²
+     * @param workerCount Solver threads including the calling thread
+     *                    (0 = one per hardware thread, 1 = single-threaded).
+     *                    Worlds with the same count share one worker pool.
+     */
+    void initialize(glm::vec2 gravity = {0.0f, 980.0f}, int workerCount = 0);
     void shutdown();
+    
+    /**
+     * @brief Advance the simulation by a frame's worth of time
+     * 
+     * Runs zero or more fixed steps (see StepSettings2D). Sensor events
+     * and pre-step callbacks are processed per fixed step. Afterwards,
+     * actors of bodies created with syncActor are moved to the
+     * interpolated pose - only bodies Box2D reported as moved are touched.
+     */
     void step(float deltaTime);
     
+    // ========================================================================
+    // FIXED TIMESTEP
+    // ========================================================================
+    
+    void setStepSettings(const StepSettings2D& settings);
+    const StepSettings2D& getStepSettings() const { return m_stepSettings; }
+    
+    /** @brief Blend factor [0, 1) between previous and current step poses */
+    float getInterpolationAlpha() const { return m_interpolationAlpha; }
+    
+    /** @brief Number of fixed steps run by the last step() call */
+    int getStepsLastFrame() const { return m_stepsLastFrame; }
+    
+    /** @brief Total fixed steps since initialize() */
+    uint64_t getStepCount() const { return m_stepCount; }
+    
+    /** @brief Timing of the most recent fixed step */
+    const StepProfile2D& getLastStepProfile() const { return m_lastStepProfile; }
+    
+    /** @brief Timing summed over the fixed steps of the last step() call */
+    const StepProfile2D& getFrameProfile() const { return m_frameProfile; }
+    
+    /** @brief Workers Box2D splits the solver across */
+    int getWorkerCount() const;
+    
+    /** @brief Bodies that moved during the last step() call that ran a step */
+    int getMovedBodyCount() const { return static_cast<int>(m_movedBodies.size()); }
+    
+    using StepCallbackId = int;
+    
+    /**
+     * @brief Register gameplay code to run before every fixed step
+     * @return Id for removePreStepCallback()
+     * 
+     * The callback receives the fixed timestep. Use it for anything that
+     * sets velocities or forces (e.g. CharacterController2D) so the result
+     * doesn't depend on frame rate. A callback may add or remove callbacks;
+     * added ones first run on the next fixed step.
+     */
+    StepCallbackId addPreStepCallback(std::function<void(float)> callback);
+    void removePreStepCallback(StepCallbackId id);
+    
     // ========================================================================
     // WORLD SETTINGS
     // ========================================================================
@@ -127,6 +325,13 @@ public:
     b2ShapeId addShape(b2BodyId bodyId, const ShapeDef2D& def);
     void removeShape(b2ShapeId shapeId);
     
+    /**
+     * @brief Take a body (and all its shapes) out of the simulation or put it back
+     * Disabled bodies keep their shapes but generate no contacts or sensor events.
+     */
+    void setBodyEnabled(b2BodyId bodyId, bool enabled);
+    bool isBodyEnabled(b2BodyId bodyId) const;
+    
     // ========================================================================
     // BODY QUERIES
     // ========================================================================
@@ -143,6 +348,24 @@ public:
     void applyForce(b2BodyId bodyId, glm::vec2 force);
     void applyImpulse(b2BodyId bodyId, glm::vec2 impulse);
     
+    /** @brief Render pose blended between the last two fixed steps */
+    glm::vec2 getInterpolatedPosition(b2BodyId bodyId) const;
+    float getInterpolatedAngle(b2BodyId bodyId) const;
+    
+    // ========================================================================
+    // SNAPSHOT
+    // ========================================================================
+    
+    /** @brief Record every body's pose, velocity and sleep state */
+    void captureSnapshot(WorldSnapshot2D& out) const;
+    
+    /**
+     * @brief Teleport bodies back to a snapshot and reset the accumulator
+     * Bodies destroyed since the capture are skipped, bodies created since
+     * are left as they are.
+     */
+    void restoreSnapshot(const WorldSnapshot2D& snapshot);
+    
     // ========================================================================
     // RAYCASTING
     // ========================================================================
@@ -157,6 +380,27 @@ public:
     
     RaycastResult raycast(glm::vec2 start, glm::vec2 end, CollisionCategory mask = CollisionCategory::All) const;
     
+    // ========================================================================
+    // BATCHED QUERIES
+    // ========================================================================
+    // Run a frame's worth of queries in one call. Output goes to caller-owned
+    // arrays: results[count] and hits[count * maxHitsPerQuery], so nothing is
+    // allocated per query. With parallel = true the batch is split across the
+    // solver's worker pool. Don't call from inside Box2D callbacks.
+    
+    void castRays(const RayQuery2D* queries, int count, QueryMode2D mode,
+                  QueryResult2D* results, QueryHit2D* hits, int maxHitsPerQuery,
+                  bool parallel = false) const;
+    
+    void castShapes(const ShapeCastQuery2D* queries, int count, QueryMode2D mode,
+                    QueryResult2D* results, QueryHit2D* hits, int maxHitsPerQuery,
+                    bool parallel = false) const;
+    
+    /** @brief Shapes whose bounds overlap each box (only shapeId is set in hits) */
+    void overlapAABBs(const OverlapQuery2D* queries, int count,
+                      QueryResult2D* results, QueryHit2D* hits, int maxHitsPerQuery,
+                      bool parallel = false) const;
+    
     // ========================================================================
     // DEBUG RENDERING
     // ========================================================================
@@ -172,6 +416,13 @@ public:
     std::function<void(const ContactInfo&)> onContactBegin;
     std::function<void(const ContactInfo&)> onContactEnd;
     
+    /**
+     * @brief Send a sensor shape's events straight to listener (nullptr = stop)
+     * Called during step(), after onContactBegin/onContactEnd. Cleared
+     * automatically when the shape or its body is destroyed.
+     */
+    void setSensorListener(b2ShapeId sensorShapeId, SensorListener2D* listener);
+    
     // ========================================================================
     // STATE
     // ========================================================================
@@ -180,12 +431,78 @@ public:
     b2WorldId getWorldId() const { return m_worldId; }
     
 private:
+    void fixedStep(float dt);
+    void runBatch(int count, bool parallel, const std::function<void(int)>& runQuery) const;
+    void updateProfile();
+    
+    static void* enqueueTask(b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext);
+    static void finishTask(void* userTask, void* userContext);
+    void processBodyMoveEvents();
+    void syncMovedActors();
+    void processSensorEvents();
+    
     b2WorldId m_worldId;
     bool m_initialized = false;
     bool m_debugDrawEnabled = false;
     
     // Track bodies for cleanup
     std::vector<b2BodyId> m_bodies;
+    
+    // Fixed timestep state
+    StepSettings2D m_stepSettings;
+    float m_accumulator = 0.0f;
+    float m_interpolationAlpha = 0.0f;
+    int m_stepsLastFrame = 0;
+    uint64_t m_stepCount = 0;
+    
+    StepProfile2D m_lastStepProfile;
+    StepProfile2D m_frameProfile;
+    
+    // Shared worker pool for the Box2D solver (null when single-threaded)
+    std::shared_ptr<TaskScheduler> m_scheduler;
+    
+    // Poses of non-static bodies, updated only from Box2D move events.
+    // Indexed by b2BodyId::index1 like m_sensorSlots (the id is kept to
+    // reject slots of destroyed bodies whose index was reused)
+    struct BodyState {
+        b2BodyId bodyId = b2_nullBodyId;
+        b2Transform previous;           // Before the step that last moved the body
+        b2Transform current;
+        bool syncActor = false;         // Body userData is an ActorObject* to move
+        uint64_t movedStep = 0;         // m_stepCount of that step
+        uint32_t listedFrame = 0;       // Dedup for m_movedBodies
+    };
+    
+    // Actor comes from the move event's body userData, so it follows
+    // b2Body_SetUserData instead of a pointer captured at creation
+    struct MovedBody {
+        b2BodyId bodyId;
+        ActorObject* actor = nullptr;   // nullptr unless syncActor
+    };
+    
+    BodyState* findBodyState(b2BodyId bodyId);
+    const BodyState* findBodyState(b2BodyId bodyId) const;
+    
+    std::vector<BodyState> m_bodyStates;
+    std::vector<MovedBody> m_movedBodies;
+    uint32_t m_movedFrame = 0;
+    
+    // Sensor shape -> listener, indexed by b2ShapeId::index1 (the id is kept
+    // to reject slots of destroyed shapes whose index was reused)
+    struct SensorSlot {
+        b2ShapeId shapeId = b2_nullShapeId;
+        SensorListener2D* listener = nullptr;
+    };
+    
+    SensorListener2D* findSensorListener(b2ShapeId shapeId) const;
+    void clearSensorListeners(b2BodyId bodyId);
+    
+    std::vector<SensorSlot> m_sensorSlots;
+    
+    std::vector<std::pair<StepCallbackId, std::function<void(float)>>> m_preStepCallbacks;  // Id 0 = removed
+    std::vector<std::pair<StepCallbackId, std::function<void(float)>>> m_addedPreStepCallbacks;  // Added mid-step
+    bool m_runningPreStepCallbacks = false;
+    StepCallbackId m_nextStepCallbackId = 1;
 };
 
 } // namespace physics
@@ -0,0 +1,215 @@
+/**
+ * @file BroadphaseBenchmark3D.cpp
+ * @brief Implementation of the PhysicsWorld3D broadphase benchmark
+ */
+#include "BroadphaseBenchmark3D.h"
+
+#include <PxPhysicsAPI.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+namespace engine {
+namespace physics {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsedMs(Clock::time_point start) {
+    std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+    return elapsed.count();
+}
+
+const char* toString(BroadPhase3D type) {
+    switch (type) {
+        case BroadPhase3D::SAP: return "SAP";
+        case BroadPhase3D::MBP: return "MBP";
+        case BroadPhase3D::ABP: return "ABP";
+        case BroadPhase3D::PABP: return "PABP";
+    }
+    return "?";
+}
+
+const char* toString(PruningStructure3D type) {
+    switch (type) {
+        case PruningStructure3D::None: return "none";
+        case PruningStructure3D::DynamicAABBTree: return "dynamic";
+        case PruningStructure3D::StaticAABBTree: return "static";
+    }
+    return "?";
+}
+
+void populate(PhysicsWorld3D& world, const BroadphaseBenchmarkSettings3D& settings) {
+    std::mt19937 rng(settings.seed);
+    std::uniform_real_distribution<float> coord(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> height(1.0f, 40.0f);
+    std::uniform_real_distribution<float> size(0.25f, 1.5f);
+
+    physx::PxRigidStatic* ground = world.createStaticBody(glm::vec3(0.0f, -1.0f, 0.0f));
+    if (ground) world.addBoxShape(ground, glm::vec3(60.0f, 1.0f, 60.0f));
+
+    for (int i = 0; i < settings.bodyCount; i++) {
+        bool dynamic = i % 4 == 0;
+        glm::vec3 position(coord(rng), dynamic ? height(rng) : 0.5f * height(rng), coord(rng));
+
+        physx::PxRigidActor* body = nullptr;
+        if (dynamic) {
+            PhysicsWorld3D::BodyDef3D def;
+            def.position = position;
+            body = world.createDynamicBody(def);
+        } else {
+            body = world.createStaticBody(position);
+        }
+        if (!body) continue;
+
+        bool multi = settings.multiShapeEvery > 0 && i % settings.multiShapeEvery == 1;
+        int shapeCount = multi ? 4 : 1;
+        for (int s = 0; s < shapeCount; s++) {
+            physx::PxShape* shape = (i + s) % 2 == 0
+                ? world.addBoxShape(body, glm::vec3(size(rng), size(rng), size(rng)))
+                : world.addSphereShape(body, size(rng));
+            if (shape && s > 0) {
+                shape->setLocalPose(physx::PxTransform(physx::PxVec3(1.5f * s, 0.0f, 0.0f)));
+            }
+        }
+    }
+}
+
+BroadphaseBenchmarkRun3D runOne(BroadphaseBenchmarkRun3D run, const BroadphaseBenchmarkSettings3D& settings,
+                                const std::vector<PhysicsWorld3D::RayQuery3D>& rays) {
+    WorldSettings3D worldSettings;
+    worldSettings.probeCuda = false;
+    worldSettings.meshCacheDirectory = "";
+    worldSettings.broadPhase = run.broadPhase;
+    worldSettings.mbpWorldMin = glm::vec3(-64.0f, -8.0f, -64.0f);
+    worldSettings.mbpWorldMax = glm::vec3(64.0f, 64.0f, 64.0f);
+    worldSettings.staticStructure = run.staticStructure;
+    worldSettings.dynamicStructure = run.dynamicStructure;
+    worldSettings.dynamicTreeRebuildRateHint = settings.dynamicTreeRebuildRateHint;
+    worldSettings.aggregateMinShapes = run.aggregates ? 2 : 0;
+
+    // Own scene inside the process-wide PxPhysics - no second foundation
+    PhysicsWorld3D world;
+    if (!world.initialize(worldSettings)) {
+        std::cerr << "[BroadphaseBenchmark3D] " << run.label() << ": world failed to initialize" << std::endl;
+        return run;
+    }
+
+    populate(world, settings);
+
+    const int count = static_cast<int>(rays.size());
+    std::vector<PhysicsWorld3D::QueryResult3D> results(count);
+    std::vector<PhysicsWorld3D::QueryHit3D> hits(count);
+
+    const int steps = std::max(1, settings.steps);
+    double stepTotal = 0.0;
+    double queryTotal = 0.0;
+    for (int frame = 0; frame < steps; frame++) {
+        auto start = Clock::now();
+        world.step(1.0f / 60.0f);
+        stepTotal += elapsedMs(start);
+
+        start = Clock::now();
+        world.raycastBatch(rays.data(), count, PhysicsWorld3D::QueryMode3D::Closest,
+                           results.data(), hits.data(), 1, false);
+        queryTotal += elapsedMs(start);
+    }
+
+    run.ok = true;
+    run.stepMs = stepTotal / steps;
+    run.queryMs = queryTotal / steps;
+    run.raycastHits = 0;
+    for (const auto& r : results) run.raycastHits += r.hitCount;
+
+    world.shutdown();
+    return run;
+}
+
+} // namespace
+
+std::string BroadphaseBenchmarkRun3D::label() const {
+    std::ostringstream out;
+    out << toString(broadPhase) << "/" << toString(staticStructure) << "/" << toString(dynamicStructure)
+        << (aggregates ? "/aggregates" : "");
+    return out.str();
+}
+
+std::string BroadphaseBenchmarkResult3D::summary() const {
+    std::ostringstream out;
+    for (const auto& run : runs) {
+        if (!run.ok) {
+            out << run.label() << ": failed\n";
+            continue;
+        }
+        out << run.label() << ": step " << run.stepMs << " ms, query " << run.queryMs << " ms\n";
+    }
+    if (failedRuns > 0) out << failedRuns << " of " << runs.size() << " runs failed\n";
+    if (fastestStep >= 0) out << "fastest step: " << runs[fastestStep].label() << "\n";
+    if (fastestTotal >= 0) out << "fastest step+query: " << runs[fastestTotal].label();
+    return out.str();
+}
+
+BroadphaseBenchmarkResult3D runBroadphaseBenchmark3D(const BroadphaseBenchmarkSettings3D& settings) {
+    BroadphaseBenchmarkResult3D result;
+
+    std::mt19937 rng(settings.seed + 1);
+    std::uniform_real_distribution<float> coord(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    std::vector<PhysicsWorld3D::RayQuery3D> rays(std::max(1, settings.queryCount));
+    for (auto& ray : rays) {
+        glm::vec3 direction(unit(rng), unit(rng), unit(rng));
+        if (glm::dot(direction, direction) < 1e-4f) direction = glm::vec3(0, -1, 0);
+        ray.origin = glm::vec3(coord(rng), 20.0f + 0.2f * coord(rng), coord(rng));
+        ray.direction = glm::normalize(direction);
+        ray.maxDistance = 50.0f;
+    }
+
+    const BroadPhase3D broadPhases[] = {BroadPhase3D::SAP, BroadPhase3D::MBP, BroadPhase3D::ABP, BroadPhase3D::PABP};
+    std::vector<PruningStructure3D> staticStructures = {PruningStructure3D::DynamicAABBTree};
+    std::vector<PruningStructure3D> dynamicStructures = {PruningStructure3D::DynamicAABBTree};
+    if (settings.fullSweep) {
+        staticStructures.push_back(PruningStructure3D::StaticAABBTree);
+        dynamicStructures.push_back(PruningStructure3D::None);
+    }
+
+    for (BroadPhase3D broadPhase : broadPhases) {
+        for (PruningStructure3D staticStructure : staticStructures) {
+            for (PruningStructure3D dynamicStructure : dynamicStructures) {
+                for (bool aggregates : {false, true}) {
+                    BroadphaseBenchmarkRun3D run;
+                    run.broadPhase = broadPhase;
+                    run.staticStructure = staticStructure;
+                    run.dynamicStructure = dynamicStructure;
+                    run.aggregates = aggregates;
+                    result.runs.push_back(runOne(run, settings, rays));
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < static_cast<int>(result.runs.size()); i++) {
+        const auto& run = result.runs[i];
+        if (!run.ok) {
+            result.failedRuns++;
+            continue;
+        }
+        if (result.fastestStep < 0 || run.stepMs < result.runs[result.fastestStep].stepMs) {
+            result.fastestStep = i;
+        }
+        const auto& best = result.fastestTotal < 0 ? run : result.runs[result.fastestTotal];
+        if (result.fastestTotal < 0 || run.stepMs + run.queryMs < best.stepMs + best.queryMs) {
+            result.fastestTotal = i;
+        }
+    }
+
+    std::cout << "[BroadphaseBenchmark3D] " << settings.bodyCount << " bodies, " << settings.steps
+              << " steps, " << rays.size() << " rays per step:\n" << result.summary() << std::endl;
+    return result;
+}
+
+} // namespace physics
+} // namespace engine
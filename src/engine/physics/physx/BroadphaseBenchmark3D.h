@@ -0,0 +1,59 @@
+/**
+ * @file BroadphaseBenchmark3D.h
+ * @brief Headless benchmark for PhysicsWorld3D broadphase/pruning settings
+ */
+#pragma once
+
+#include "PhysicsWorld3D.h"
+#include <string>
+#include <vector>
+
+namespace engine {
+namespace physics {
+
+struct BroadphaseBenchmarkSettings3D {
+    int bodyCount = 1000;           // A quarter dynamic, the rest static
+    int multiShapeEvery = 8;        // Every Nth body gets 4 shapes (0 = single shapes only)
+    int steps = 60;                 // Simulated frames per combination
+    int queryCount = 1000;          // Closest-hit raycasts after every frame
+    int dynamicTreeRebuildRateHint = 100;
+    unsigned int seed = 1234;
+    bool fullSweep = false;         // Also vary the pruning structures (32 runs instead of 8)
+};
+
+struct BroadphaseBenchmarkRun3D {
+    BroadPhase3D broadPhase = BroadPhase3D::PABP;
+    PruningStructure3D staticStructure = PruningStructure3D::DynamicAABBTree;
+    PruningStructure3D dynamicStructure = PruningStructure3D::DynamicAABBTree;
+    bool aggregates = false;
+    bool ok = false;                // False if the world failed to initialize
+    double stepMs = 0.0;            // Average step() per frame
+    double queryMs = 0.0;           // Average raycast batch per frame
+    int raycastHits = 0;            // Last frame, should match across runs
+
+    std::string label() const;
+};
+
+struct BroadphaseBenchmarkResult3D {
+    std::vector<BroadphaseBenchmarkRun3D> runs;
+    int fastestStep = -1;           // Index into runs, failed runs are skipped
+    int fastestTotal = -1;          // Lowest stepMs + queryMs
+    int failedRuns = 0;
+
+    std::string summary() const;
+};
+
+/**
+ * @brief Runs the same scene under every broadphase/aggregate combination
+ *
+ * Each combination gets its own PhysicsWorld3D (CUDA probe off, MBP bounds
+ * around the scene): random boxes and spheres fall onto a ground slab while a
+ * raycast batch runs after every step. Nothing touches the active scene; the
+ * worlds share the process-wide PhysX foundation with the editor's world.
+ * The default sweep keeps the default pruning structures; fullSweep adds
+ * every static/dynamic pruning pair. Runs synchronously on the caller.
+ */
+BroadphaseBenchmarkResult3D runBroadphaseBenchmark3D(const BroadphaseBenchmarkSettings3D& settings);
+
+} // namespace physics
+} // namespace engine
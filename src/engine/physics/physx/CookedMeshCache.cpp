@@ -0,0 +1,239 @@
+/**
+ * @file CookedMeshCache.cpp
+ * @brief Implementation of CookedMeshCache
+ */
+#include "CookedMeshCache.h"
+
+#include <PxPhysicsAPI.h>
+#include <cooking/PxCooking.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+using namespace physx;
+
+namespace engine {
+namespace physics {
+
+namespace {
+
+// Bump when the key layout or file contents change
+constexpr uint64_t CACHE_FORMAT_VERSION = 2;
+
+/** @brief FNV-1a, 64-bit */
+struct Hasher {
+    uint64_t value = 14695981039346656037ull;
+    
+    void bytes(const void* data, size_t size) {
+        const auto* p = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; i++) {
+            value ^= p[i];
+            value *= 1099511628211ull;
+        }
+    }
+    
+    template<typename T>
+    void add(const T& v) { bytes(&v, sizeof(T)); }
+};
+
+PxCookingParams makeCookingParams(const PxPhysics& physics) {
+    return PxCookingParams(physics.getTolerancesScale());
+}
+
+} // namespace
+
+CollisionMeshData::CollisionMeshData(std::vector<glm::vec3> vertices, std::vector<uint32_t> indices)
+    : m_vertices(std::move(vertices))
+    , m_indices(std::move(indices))
+{
+    Hasher hash;
+    uint64_t vertexCount = m_vertices.size();
+    hash.add(vertexCount);
+    hash.bytes(m_vertices.data(), m_vertices.size() * sizeof(glm::vec3));
+    
+    uint64_t indexCount = m_indices.size();
+    hash.add(indexCount);
+    hash.bytes(m_indices.data(), m_indices.size() * sizeof(uint32_t));
+    
+    m_contentHash = hash.value;
+}
+
+CookedMeshCache::CookedMeshCache(PxPhysics& physics, const std::string& cacheDirectory)
+    : m_physics(physics)
+    , m_cacheDirectory(cacheDirectory)
+{
+    Hasher hash;
+    hash.add(CACHE_FORMAT_VERSION);
+    hash.add(static_cast<uint32_t>(PX_PHYSICS_VERSION));
+    
+    // Field by field - the params struct has padding
+    PxCookingParams params = makeCookingParams(m_physics);
+    hash.add(params.scale.length);
+    hash.add(params.scale.speed);
+    hash.add(params.areaTestEpsilon);
+    hash.add(params.planeTolerance);
+    hash.add(static_cast<uint32_t>(params.convexMeshCookingType));
+    hash.add(params.suppressTriangleMeshRemapTable);
+    hash.add(params.buildTriangleAdjacencies);
+    hash.add(params.buildGPUData);
+    hash.add(static_cast<uint32_t>(params.meshPreprocessParams));
+    hash.add(params.meshWeldTolerance);
+    hash.add(static_cast<uint32_t>(params.midphaseDesc.getType()));
+    hash.add(params.gaussMapLimit);
+    m_paramsHash = hash.value;
+}
+
+CookedMeshCache::~CookedMeshCache() {
+    clear();
+}
+
+void CookedMeshCache::clear() {
+    for (auto& [key, mesh] : m_meshes) {
+        if (mesh) mesh->release();
+    }
+    m_meshes.clear();
+}
+
+PxTriangleMesh* CookedMeshCache::getTriangleMesh(const CollisionMeshData& mesh) {
+    PxBase* base = getMesh(MeshKind::Triangle, mesh);
+    return base ? base->is<PxTriangleMesh>() : nullptr;
+}
+
+PxConvexMesh* CookedMeshCache::getConvexMesh(const CollisionMeshData& mesh) {
+    PxBase* base = getMesh(MeshKind::Convex, mesh);
+    return base ? base->is<PxConvexMesh>() : nullptr;
+}
+
+PxBase* CookedMeshCache::getMesh(MeshKind kind, const CollisionMeshData& mesh) {
+    if (mesh.empty()) return nullptr;
+    if (kind == MeshKind::Triangle && mesh.getIndices().size() < 3) return nullptr;
+    
+    uint64_t key = computeKey(kind, mesh);
+    
+    auto it = m_meshes.find(key);
+    if (it != m_meshes.end()) {
+        m_stats.memoryHits++;
+        return it->second;
+    }
+    
+    std::string path = getCachePath(kind, key);
+    std::vector<uint8_t> stream;
+    
+    if (!path.empty() && readFile(path, stream)) {
+        if (PxBase* created = createFromStream(kind, stream.data(), stream.size())) {
+            m_stats.diskHits++;
+            m_meshes[key] = created;
+            return created;
+        }
+        std::cout << "[CookedMeshCache] Stale cache file, recooking: " << path << std::endl;
+    }
+    
+    stream.clear();
+    if (!cook(kind, mesh, stream)) {
+        m_stats.failed++;
+        std::cerr << "[CookedMeshCache] Cooking failed (" << mesh.getVertices().size()
+                  << " vertices, " << mesh.getIndices().size() / 3 << " triangles)" << std::endl;
+        return nullptr;
+    }
+    m_stats.cooked++;
+    
+    if (!path.empty()) {
+        writeFile(path, stream.data(), stream.size());
+    }
+    
+    PxBase* created = createFromStream(kind, stream.data(), stream.size());
+    if (created) {
+        m_meshes[key] = created;
+    }
+    return created;
+}
+
+uint64_t CookedMeshCache::computeKey(MeshKind kind, const CollisionMeshData& mesh) const {
+    // Parameters and content are hashed once each - only combine them here
+    Hasher hash;
+    hash.add(m_paramsHash);
+    hash.add(kind);
+    hash.add(mesh.getContentHash());
+    return hash.value;
+}
+
+std::string CookedMeshCache::getCachePath(MeshKind kind, uint64_t key) const {
+    if (m_cacheDirectory.empty()) return {};
+    
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx%s", static_cast<unsigned long long>(key),
+                  kind == MeshKind::Triangle ? ".tri" : ".cvx");
+    return (std::filesystem::path(m_cacheDirectory) / name).string();
+}
+
+bool CookedMeshCache::readFile(const std::string& path, std::vector<uint8_t>& out) const {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+    
+    std::streamsize size = file.tellg();
+    if (size <= 0) return false;
+    
+    out.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(out.data()), size));
+}
+
+void CookedMeshCache::writeFile(const std::string& path, const uint8_t* data, size_t size) const {
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+    
+    // Write then rename, so a crash never leaves a half-written file under the final name
+    std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file || !file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size))) {
+            std::cerr << "[CookedMeshCache] Could not write " << tempPath << std::endl;
+            return;
+        }
+    }
+    
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        std::filesystem::remove(tempPath, ec);
+    }
+}
+
+PxBase* CookedMeshCache::createFromStream(MeshKind kind, const uint8_t* data, size_t size) {
+    PxDefaultMemoryInputData input(const_cast<PxU8*>(data), static_cast<PxU32>(size));
+    if (kind == MeshKind::Triangle) {
+        return m_physics.createTriangleMesh(input);
+    }
+    return m_physics.createConvexMesh(input);
+}
+
+bool CookedMeshCache::cook(MeshKind kind, const CollisionMeshData& mesh, std::vector<uint8_t>& out) const {
+    PxCookingParams params = makeCookingParams(m_physics);
+    PxDefaultMemoryOutputStream stream;
+    bool ok = false;
+    
+    if (kind == MeshKind::Triangle) {
+        PxTriangleMeshDesc desc;
+        desc.points.count = static_cast<PxU32>(mesh.getVertices().size());
+        desc.points.stride = sizeof(glm::vec3);
+        desc.points.data = mesh.getVertices().data();
+        desc.triangles.count = static_cast<PxU32>(mesh.getIndices().size() / 3);
+        desc.triangles.stride = 3 * sizeof(uint32_t);
+        desc.triangles.data = mesh.getIndices().data();
+        ok = PxCookTriangleMesh(params, desc, stream);
+    } else {
+        PxConvexMeshDesc desc;
+        desc.points.count = static_cast<PxU32>(mesh.getVertices().size());
+        desc.points.stride = sizeof(glm::vec3);
+        desc.points.data = mesh.getVertices().data();
+        desc.flags = PxConvexFlag::eCOMPUTE_CONVEX;
+        ok = PxCookConvexMesh(params, desc, stream);
+    }
+    
+    if (!ok) return false;
+    out.assign(stream.getData(), stream.getData() + stream.getSize());
+    return true;
+}
+
+} // namespace physics
+} // namespace engine
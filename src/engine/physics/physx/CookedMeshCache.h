@@ -0,0 +1,124 @@
+/**
+ * @file CookedMeshCache.h
+ * @brief On-disk cache of cooked PhysX triangle and convex meshes
+ */
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace physx {
+    class PxPhysics;
+    class PxTriangleMesh;
+    class PxConvexMesh;
+    class PxBase;
+}
+
+namespace engine {
+namespace physics {
+
+/**
+ * @brief Source geometry for mesh collision
+ * 
+ * indices are triangles (3 per face). Convex meshes only use the
+ * vertices - PhysX computes the hull.
+ * 
+ * Immutable once constructed: the content hash used as the cache key is
+ * computed in the constructor, so lookups and copies never see a hash
+ * that no longer matches the geometry. Build a new mesh to change it.
+ */
+class CollisionMeshData {
+public:
+    CollisionMeshData() : CollisionMeshData({}, {}) {}
+    CollisionMeshData(std::vector<glm::vec3> vertices, std::vector<uint32_t> indices);
+    
+    const std::vector<glm::vec3>& getVertices() const { return m_vertices; }
+    const std::vector<uint32_t>& getIndices() const { return m_indices; }
+    
+    bool empty() const { return m_vertices.empty(); }
+    
+    /** @brief 64-bit hash of vertices and indices */
+    uint64_t getContentHash() const { return m_contentHash; }
+    
+private:
+    std::vector<glm::vec3> m_vertices;
+    std::vector<uint32_t> m_indices;
+    uint64_t m_contentHash = 0;
+};
+
+/**
+ * @brief Cooks PhysX meshes once and reuses the result
+ * 
+ * Meshes are keyed by a 64-bit hash of the source vertices/indices, the
+ * cooking parameters and the PhysX version. Only the mesh's cached content
+ * hash is read per lookup, so repeated lookups of a mesh don't touch its
+ * vertex data. A lookup tries, in order:
+ * 1. Meshes already created this session (shared, reference counted)
+ * 2. <cacheDirectory>/<key>.tri / .cvx - deserialized without cooking
+ * 3. Cooking, after which the cooked stream is written to disk
+ * 
+ * A file that PhysX refuses to load (older SDK, truncated write) is
+ * cooked again and overwritten.
+ * 
+ * Owned by PhysicsWorld3D (see getMeshCache()).
+ * 
+ * @par Thread Safety
+ * Not thread-safe. Call from the thread that creates bodies.
+ */
+class CookedMeshCache {
+public:
+    struct Stats {
+        int memoryHits = 0;
+        int diskHits = 0;
+        int cooked = 0;
+        int failed = 0;
+    };
+    
+    /** @param cacheDirectory Empty = memory only, nothing is read or written */
+    CookedMeshCache(physx::PxPhysics& physics, const std::string& cacheDirectory);
+    ~CookedMeshCache();
+    
+    CookedMeshCache(const CookedMeshCache&) = delete;
+    CookedMeshCache& operator=(const CookedMeshCache&) = delete;
+    
+    /**
+     * @brief Triangle mesh for static/kinematic bodies
+     * @return Mesh owned by the cache (valid until clear()), nullptr if cooking failed
+     */
+    physx::PxTriangleMesh* getTriangleMesh(const CollisionMeshData& mesh);
+    
+    /** @brief Convex hull of the vertices, usable on dynamic bodies */
+    physx::PxConvexMesh* getConvexMesh(const CollisionMeshData& mesh);
+    
+    /** @brief Release the cache's references (shapes keep theirs) */
+    void clear();
+    
+    const std::string& getCacheDirectory() const { return m_cacheDirectory; }
+    const Stats& getStats() const { return m_stats; }
+    
+private:
+    enum class MeshKind : uint8_t { Triangle = 1, Convex = 2 };
+    
+    uint64_t computeKey(MeshKind kind, const CollisionMeshData& mesh) const;
+    std::string getCachePath(MeshKind kind, uint64_t key) const;
+    
+    bool readFile(const std::string& path, std::vector<uint8_t>& out) const;
+    void writeFile(const std::string& path, const uint8_t* data, size_t size) const;
+    
+    physx::PxBase* createFromStream(MeshKind kind, const uint8_t* data, size_t size);
+    bool cook(MeshKind kind, const CollisionMeshData& mesh, std::vector<uint8_t>& out) const;
+    physx::PxBase* getMesh(MeshKind kind, const CollisionMeshData& mesh);
+    
+    physx::PxPhysics& m_physics;
+    std::string m_cacheDirectory;
+    uint64_t m_paramsHash = 0;      // Format/SDK version and cooking parameters
+    std::unordered_map<uint64_t, physx::PxBase*> m_meshes;
+    Stats m_stats;
+};
+
+} // namespace physics
+} // namespace engine
@@ -0,0 +1,173 @@
+/**
+ * @file PhysicsQueryBenchmark3D.cpp
+ * @brief Implementation of the PhysicsWorld3D query benchmark
+ */
+#include "PhysicsQueryBenchmark3D.h"
+#include "PhysicsWorld3D.h"
+
+#include <PxPhysicsAPI.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace engine {
+namespace physics {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/** @brief Best wall time of iterations runs, in milliseconds */
+template<typename Fn>
+double bestOf(int iterations, Fn&& fn) {
+    double best = std::numeric_limits<double>::max();
+    for (int i = 0; i < std::max(1, iterations); i++) {
+        auto start = Clock::now();
+        fn();
+        std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+} // namespace
+
+std::string QueryBenchmarkResult3D::summary() const {
+    std::ostringstream out;
+    out << "raycast single: " << singleRaycastMs << " ms"
+        << ", batch: " << batchRaycastMs << " ms"
+        << ", parallel (" << workerCount << " workers): " << parallelRaycastMs << " ms"
+        << ", parallel all-hits: " << parallelRaycastAllMs << " ms"
+        << ", sweep: " << parallelSweepMs << " ms"
+        << ", overlap: " << parallelOverlapMs << " ms"
+        << ", hits: " << raycastHits;
+    if (truncatedRaycastsAll > 0 || truncatedOverlaps > 0) {
+        out << ", truncated (buffer overflow): " << truncatedRaycastsAll << " all-hits raycasts, "
+            << truncatedOverlaps << " overlaps";
+    }
+    return out.str();
+}
+
+QueryBenchmarkResult3D runQueryBenchmark3D(const QueryBenchmarkSettings3D& settings) {
+    using World = PhysicsWorld3D;
+    QueryBenchmarkResult3D result;
+    
+    WorldSettings3D worldSettings;
+    worldSettings.probeCuda = false;
+    
+    // Own scene inside the process-wide PxPhysics, next to the editor's world
+    PhysicsWorld3D world;
+    if (!world.initialize(worldSettings)) return result;
+    
+    std::mt19937 rng(settings.seed);
+    std::uniform_real_distribution<float> coord(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> size(0.25f, 2.0f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    
+    for (int i = 0; i < settings.bodyCount; i++) {
+        glm::vec3 position(coord(rng), coord(rng), coord(rng));
+        physx::PxRigidActor* body = nullptr;
+        if (i % 4 == 0) {
+            World::BodyDef3D def;
+            def.position = position;
+            def.useGravity = false;
+            body = world.createDynamicBody(def);
+        } else {
+            body = world.createStaticBody(position);
+        }
+        if (!body) continue;
+        
+        if (i % 2 == 0) {
+            world.addBoxShape(body, glm::vec3(size(rng), size(rng), size(rng)));
+        } else {
+            world.addSphereShape(body, size(rng));
+        }
+    }
+    
+    // One step so the pruning structures hold every body
+    world.step(1.0f / 60.0f);
+    
+    const int count = std::max(1, settings.queryCount);
+    const int maxHits = std::max(1, settings.maxHitsPerQuery);
+    
+    std::vector<World::RayQuery3D> rays(count);
+    std::vector<World::SweepQuery3D> sweeps(count);
+    std::vector<World::OverlapQuery3D> overlaps(count);
+    for (int i = 0; i < count; i++) {
+        glm::vec3 origin(coord(rng), coord(rng), coord(rng));
+        glm::vec3 direction(unit(rng), unit(rng), unit(rng));
+        if (glm::dot(direction, direction) < 1e-4f) direction = glm::vec3(0, -1, 0);
+        
+        rays[i].origin = origin;
+        rays[i].direction = glm::normalize(direction);
+        rays[i].maxDistance = 50.0f;
+        
+        sweeps[i].shape.type = World::ShapeDef3D::Type::Sphere;
+        sweeps[i].shape.radius = 0.5f;
+        sweeps[i].shape.position = origin;
+        sweeps[i].direction = rays[i].direction;
+        sweeps[i].maxDistance = 25.0f;
+        
+        overlaps[i].shape.type = World::ShapeDef3D::Type::Box;
+        overlaps[i].shape.halfExtents = glm::vec3(2.0f);
+        overlaps[i].shape.position = origin;
+    }
+    
+    std::vector<World::QueryResult3D> results(count);
+    std::vector<World::QueryHit3D> hits(static_cast<size_t>(count) * maxHits);
+    
+    int singleHits = 0;
+    result.singleRaycastMs = bestOf(settings.iterations, [&]() {
+        singleHits = 0;
+        for (const auto& ray : rays) {
+            if (world.raycast(ray.origin, ray.direction, ray.maxDistance).hit) singleHits++;
+        }
+    });
+    
+    result.batchRaycastMs = bestOf(settings.iterations, [&]() {
+        world.raycastBatch(rays.data(), count, World::QueryMode3D::Closest,
+                           results.data(), hits.data(), maxHits, false);
+    });
+    
+    result.parallelRaycastMs = bestOf(settings.iterations, [&]() {
+        world.raycastBatch(rays.data(), count, World::QueryMode3D::Closest,
+                           results.data(), hits.data(), maxHits, true);
+    });
+    
+    for (const auto& r : results) result.raycastHits += r.hitCount;
+    if (result.raycastHits != singleHits) {
+        std::cerr << "[QueryBenchmark3D] Hit count mismatch: single " << singleHits
+                  << ", batched " << result.raycastHits << std::endl;
+    }
+    
+    result.parallelRaycastAllMs = bestOf(settings.iterations, [&]() {
+        world.raycastBatch(rays.data(), count, World::QueryMode3D::All,
+                           results.data(), hits.data(), maxHits, true);
+    });
+    for (const auto& r : results) result.truncatedRaycastsAll += r.truncated ? 1 : 0;
+    
+    result.parallelSweepMs = bestOf(settings.iterations, [&]() {
+        world.sweepBatch(sweeps.data(), count, World::QueryMode3D::Closest,
+                         results.data(), hits.data(), maxHits, true);
+    });
+    
+    result.parallelOverlapMs = bestOf(settings.iterations, [&]() {
+        world.overlapBatch(overlaps.data(), count,
+                           results.data(), hits.data(), maxHits, true);
+    });
+    for (const auto& r : results) result.truncatedOverlaps += r.truncated ? 1 : 0;
+    
+    result.workerCount = world.getDispatcherThreadCount() + 1;
+    world.shutdown();
+    
+    std::cout << "[QueryBenchmark3D] " << settings.bodyCount << " bodies, "
+              << count << " queries: " << result.summary() << std::endl;
+    return result;
+}
+
+} // namespace physics
+} // namespace engine
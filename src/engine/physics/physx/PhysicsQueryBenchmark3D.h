@@ -0,0 +1,46 @@
+/**
+ * @file PhysicsQueryBenchmark3D.h
+ * @brief Headless benchmark for PhysicsWorld3D scene queries
+ */
+#pragma once
+
+#include <string>
+
+namespace engine {
+namespace physics {
+
+struct QueryBenchmarkSettings3D {
+    int bodyCount = 2000;
+    int queryCount = 10000;
+    int maxHitsPerQuery = 8;
+    int iterations = 5;             // Best time of N runs is reported
+    unsigned int seed = 1234;
+};
+
+struct QueryBenchmarkResult3D {
+    double singleRaycastMs = 0.0;
+    double batchRaycastMs = 0.0;
+    double parallelRaycastMs = 0.0;
+    double parallelRaycastAllMs = 0.0;
+    double parallelSweepMs = 0.0;
+    double parallelOverlapMs = 0.0;
+    int raycastHits = 0;            // Closest-hit count, equal for single and batched runs
+    int truncatedRaycastsAll = 0;   // All-hits raycasts that overflowed maxHitsPerQuery
+    int truncatedOverlaps = 0;      // Overlaps that overflowed maxHitsPerQuery
+    int workerCount = 0;
+    
+    std::string summary() const;
+};
+
+/**
+ * @brief Compares single raycast() calls with raycastBatch/sweepBatch/overlapBatch
+ *
+ * Builds its own PhysicsWorld3D (CUDA probe off) filled with random static
+ * and dynamic boxes/spheres, so it can run from the editor without touching
+ * the active scene. The world shares the process-wide PhysX foundation with
+ * the editor's world. Returns an empty result if it can't be created.
+ */
+QueryBenchmarkResult3D runQueryBenchmark3D(const QueryBenchmarkSettings3D& settings);
+
+} // namespace physics
+} // namespace engine
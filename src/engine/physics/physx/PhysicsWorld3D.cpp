@@ -3,11 +3,18 @@
  * @brief PhysX-based 3D physics world implementation
  */
 #include "PhysicsWorld3D.h"
+#include "engine/utils/TaskScheduler.h"
 
 // PhysX includes
 #include <PxPhysicsAPI.h>
 #include <characterkinematic/PxControllerManager.h>
+#include <extensions/PxBroadPhaseExt.h>
+#include <glm/gtc/quaternion.hpp>
+#include <algorithm>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
 
 using namespace physx;
 
@@ -56,77 +63,211 @@ PhysicsWorld3D::~PhysicsWorld3D() {
 // ============================================================================
 
 void PhysicsWorld3D::initialize() {
-    if (m_initialized) return;
+    initialize(m_settings);
+}
+
+bool PhysicsWorld3D::initialize(const WorldSettings3D& settings) {
+    if (m_initialized) return true;
+    
+    m_settings = settings;
     
     std::cout << "[PhysicsWorld3D] Initializing PhysX..." << std::endl;
     
-    initializeFoundation();
-    initializePVD();
-    initializeCuda();
-    initializePhysics();
-    initializeScene();
+    if (!acquireSharedPhysX() || !initializeWorldObjects() || !initializeScene()) {
+        std::cerr << "[PhysicsWorld3D] Initialization failed" << std::endl;
+        releasePhysXObjects();
+        return false;
+    }
     
     m_initialized = true;
     std::cout << "[PhysicsWorld3D] Initialized successfully" 
               << (m_cudaContext ? " (GPU acceleration enabled)" : " (CPU only)")
+              << ", " << m_dispatcherThreads << " dispatcher thread(s)"
               << std::endl;
+    return true;
 }
 
-void PhysicsWorld3D::initializeFoundation() {
-    m_foundation = PxCreateFoundation(PX_PHYSICS_VERSION, gAllocator, gErrorCallback);
-    if (!m_foundation) {
-        std::cerr << "[PhysicsWorld3D] PxCreateFoundation failed!" << std::endl;
-        return;
-    }
+// ============================================================================
+// SHARED PHYSX CORE
+// ============================================================================
+
+namespace {
+
+/**
+ * PhysX allows one foundation per process, so every PhysicsWorld3D (the
+ * editor's play world, benchmark worlds) shares the foundation, PxPhysics,
+ * PVD and CUDA context. Each world only owns its scene and what hangs off it.
+ */
+struct SharedPhysX {
+    PxFoundation* foundation = nullptr;
+    PxPvd* pvd = nullptr;
+    PxCudaContextManager* cudaContext = nullptr;
+    PxPhysics* physics = nullptr;
+    bool cudaProbed = false;
+    int refCount = 0;
+};
+
+SharedPhysX gShared;
+std::mutex gSharedMutex;
+
+void releaseSharedObjects() {
+    if (gShared.physics) { gShared.physics->release(); gShared.physics = nullptr; }
+    if (gShared.pvd) { gShared.pvd->release(); gShared.pvd = nullptr; }
+    if (gShared.cudaContext) { gShared.cudaContext->release(); gShared.cudaContext = nullptr; }
+    if (gShared.foundation) { gShared.foundation->release(); gShared.foundation = nullptr; }
+    gShared.cudaProbed = false;
 }
 
-void PhysicsWorld3D::initializePVD() {
+bool createSharedObjects() {
+    gShared.foundation = PxCreateFoundation(PX_PHYSICS_VERSION, gAllocator, gErrorCallback);
+    if (!gShared.foundation) {
+        std::cerr << "[PhysicsWorld3D] PxCreateFoundation failed!" << std::endl;
+        return false;
+    }
+    
+    // PhysX Visual Debugger
 #ifdef _DEBUG
-    m_pvd = PxCreatePvd(*m_foundation);
-    if (m_pvd) {
+    gShared.pvd = PxCreatePvd(*gShared.foundation);
+    if (gShared.pvd) {
         PxPvdTransport* transport = PxDefaultPvdSocketTransportCreate("127.0.0.1", 5425, 10);
-        m_pvd->connect(*transport, PxPvdInstrumentationFlag::eALL);
+        gShared.pvd->connect(*transport, PxPvdInstrumentationFlag::eALL);
         std::cout << "[PhysicsWorld3D] PVD connection attempted (localhost:5425)" << std::endl;
     }
 #endif
+    
+    PxTolerancesScale scale;
+    scale.length = 1.0f;   // 1 unit = 1 meter
+    scale.speed = 10.0f;   // Typical speed
+    
+    gShared.physics = PxCreatePhysics(PX_PHYSICS_VERSION, *gShared.foundation, scale, true, gShared.pvd);
+    if (!gShared.physics) {
+        std::cerr << "[PhysicsWorld3D] PxCreatePhysics failed!" << std::endl;
+        return false;
+    }
+    return true;
 }
 
-void PhysicsWorld3D::initializeCuda() {
+// Probed by the first world that asks for it, then kept for all worlds
+void probeSharedCuda() {
+    if (gShared.cudaProbed) return;
+    gShared.cudaProbed = true;
+    
 #if PX_SUPPORT_GPU_PHYSX
     PxCudaContextManagerDesc cudaDesc;
-    m_cudaContext = PxCreateCudaContextManager(*m_foundation, cudaDesc, PxGetProfilerCallback());
-    if (m_cudaContext && !m_cudaContext->contextIsValid()) {
-        m_cudaContext->release();
-        m_cudaContext = nullptr;
+    gShared.cudaContext = PxCreateCudaContextManager(*gShared.foundation, cudaDesc, PxGetProfilerCallback());
+    if (gShared.cudaContext && !gShared.cudaContext->contextIsValid()) {
+        gShared.cudaContext->release();
+        gShared.cudaContext = nullptr;
         std::cout << "[PhysicsWorld3D] CUDA context invalid, using CPU" << std::endl;
     }
 #endif
 }
 
-void PhysicsWorld3D::initializePhysics() {
-    PxTolerancesScale scale;
-    scale.length = 1.0f;   // 1 unit = 1 meter
-    scale.speed = 10.0f;   // Typical speed
+} // namespace
+
+bool PhysicsWorld3D::acquireSharedPhysX() {
+    std::lock_guard<std::mutex> lock(gSharedMutex);
     
-    m_physics = PxCreatePhysics(PX_PHYSICS_VERSION, *m_foundation, scale, true, m_pvd);
-    if (!m_physics) {
-        std::cerr << "[PhysicsWorld3D] PxCreatePhysics failed!" << std::endl;
-        return;
+    if (gShared.refCount == 0 && !createSharedObjects()) {
+        releaseSharedObjects();
+        return false;
+    }
+    if (m_settings.probeCuda) {
+        probeSharedCuda();
+    } else if (!gShared.cudaProbed) {
+        std::cout << "[PhysicsWorld3D] CUDA probe skipped" << std::endl;
     }
     
+    gShared.refCount++;
+    m_ownsSharedRef = true;
+    m_foundation = gShared.foundation;
+    m_physics = gShared.physics;
+    m_pvd = gShared.pvd;
+    m_cudaContext = m_settings.probeCuda ? gShared.cudaContext : nullptr;
+    return true;
+}
+
+void PhysicsWorld3D::releaseSharedPhysX() {
+    m_foundation = nullptr;
+    m_physics = nullptr;
+    m_pvd = nullptr;
+    m_cudaContext = nullptr;
+    if (!m_ownsSharedRef) return;
+    m_ownsSharedRef = false;
+    
+    std::lock_guard<std::mutex> lock(gSharedMutex);
+    if (--gShared.refCount == 0) {
+        releaseSharedObjects();
+    }
+}
+
+bool PhysicsWorld3D::initializeWorldObjects() {
     // Create default material
     m_defaultMaterial = m_physics->createMaterial(0.5f, 0.5f, 0.3f);
+    if (!m_defaultMaterial) {
+        std::cerr << "[PhysicsWorld3D] createMaterial failed!" << std::endl;
+        return false;
+    }
+    
+    m_meshCache = std::make_unique<CookedMeshCache>(*m_physics, m_settings.meshCacheDirectory);
+    return true;
 }
 
-void PhysicsWorld3D::initializeScene() {
+namespace {
+
+PxBroadPhaseType::Enum toPxBroadPhase(BroadPhase3D type) {
+    switch (type) {
+        case BroadPhase3D::SAP: return PxBroadPhaseType::eSAP;
+        case BroadPhase3D::MBP: return PxBroadPhaseType::eMBP;
+        case BroadPhase3D::ABP: return PxBroadPhaseType::eABP;
+        case BroadPhase3D::PABP: break;
+    }
+    return PxBroadPhaseType::ePABP;
+}
+
+PxPruningStructureType::Enum toPxPruning(PruningStructure3D type) {
+    switch (type) {
+        case PruningStructure3D::None: return PxPruningStructureType::eNONE;
+        case PruningStructure3D::StaticAABBTree: return PxPruningStructureType::eSTATIC_AABB_TREE;
+        case PruningStructure3D::DynamicAABBTree: break;
+    }
+    return PxPruningStructureType::eDYNAMIC_AABB_TREE;
+}
+
+} // namespace
+
+bool PhysicsWorld3D::initializeScene() {
     PxSceneDesc sceneDesc(m_physics->getTolerancesScale());
     sceneDesc.gravity = PxVec3(m_gravity.x, m_gravity.y, m_gravity.z);
     
-    // CPU dispatcher
-    m_dispatcher = PxDefaultCpuDispatcherCreate(4);  // 4 threads
+    // CPU dispatcher - leave one hardware thread for the game thread,
+    // which also works while the simulation runs (see beginStep)
+    m_dispatcherThreads = m_settings.dispatcherThreads;
+    if (m_dispatcherThreads <= 0) {
+        m_dispatcherThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+    }
+    m_dispatcher = PxDefaultCpuDispatcherCreate(static_cast<PxU32>(m_dispatcherThreads));
+    if (!m_dispatcher) {
+        std::cerr << "[PhysicsWorld3D] PxDefaultCpuDispatcherCreate failed!" << std::endl;
+        return false;
+    }
     sceneDesc.cpuDispatcher = m_dispatcher;
     sceneDesc.filterShader = PxDefaultSimulationFilterShader;
     
+    // Report moved bodies after each step so only those sync back to actors
+    sceneDesc.flags |= PxSceneFlag::eENABLE_ACTIVE_ACTORS;
+    
+    // Broadphase and scene-query structures
+    sceneDesc.broadPhaseType = toPxBroadPhase(m_settings.broadPhase);
+    if (m_settings.staticStructure == PruningStructure3D::None) {
+        std::cerr << "[PhysicsWorld3D] Static pruning structure can't be None, using DynamicAABBTree" << std::endl;
+        m_settings.staticStructure = PruningStructure3D::DynamicAABBTree;
+    }
+    sceneDesc.staticStructure = toPxPruning(m_settings.staticStructure);
+    sceneDesc.dynamicStructure = toPxPruning(m_settings.dynamicStructure);
+    m_settings.dynamicTreeRebuildRateHint = std::max(4, m_settings.dynamicTreeRebuildRateHint);
+    sceneDesc.dynamicTreeRebuildRateHint = static_cast<PxU32>(m_settings.dynamicTreeRebuildRateHint);
+    
     // GPU acceleration if available
 #if PX_SUPPORT_GPU_PHYSX
     if (m_cudaContext) {
@@ -139,7 +280,25 @@ void PhysicsWorld3D::initializeScene() {
     m_scene = m_physics->createScene(sceneDesc);
     if (!m_scene) {
         std::cerr << "[PhysicsWorld3D] createScene failed!" << std::endl;
-        return;
+        return false;
+    }
+    
+    // MBP only collides bodies inside its regions - grid over the configured bounds
+    if (sceneDesc.broadPhaseType == PxBroadPhaseType::eMBP) {
+        m_settings.mbpSubdivisions = std::clamp(m_settings.mbpSubdivisions, 1, 16);
+        const glm::vec3& lo = m_settings.mbpWorldMin;
+        const glm::vec3& hi = m_settings.mbpWorldMax;
+        PxBounds3 bounds(PxVec3(lo.x, lo.y, lo.z), PxVec3(hi.x, hi.y, hi.z));
+        
+        std::vector<PxBounds3> regions(m_settings.mbpSubdivisions * m_settings.mbpSubdivisions);
+        PxU32 count = PxBroadPhaseExt::createRegionsFromWorldBounds(
+            regions.data(), bounds, static_cast<PxU32>(m_settings.mbpSubdivisions));
+        for (PxU32 i = 0; i < count; i++) {
+            PxBroadPhaseRegion region;
+            region.mBounds = regions[i];
+            region.mUserData = nullptr;
+            m_scene->addBroadPhaseRegion(region);
+        }
     }
     
     // Enable PVD client
@@ -151,6 +310,7 @@ void PhysicsWorld3D::initializeScene() {
         pvdClient->setScenePvdFlag(PxPvdSceneFlag::eTRANSMIT_SCENEQUERIES, true);
     }
 #endif
+    return true;
 }
 
 void PhysicsWorld3D::shutdown() {
@@ -158,39 +318,122 @@ void PhysicsWorld3D::shutdown() {
     
     std::cout << "[PhysicsWorld3D] Shutting down..." << std::endl;
     
+    // Bodies can't be removed while a step is in flight
+    endStep(true);
+    
     // Destroy tracked bodies
     for (auto* body : m_bodies) {
         if (body) {
-            m_scene->removeActor(*body);
-            body->release();
+            removeBodyFromScene(body);
+            releaseBody(body);
         }
     }
     m_bodies.clear();
+    m_pendingAggregates.clear();
+    m_moveListenerCount = 0;
+    m_activeActorCount = 0;
+    
+    m_queryScheduler.reset();
+    m_queryScratch.clear();
+    
+    releasePhysXObjects();
+    
+    m_initialized = false;
+    std::cout << "[PhysicsWorld3D] Shutdown complete" << std::endl;
+}
+
+void PhysicsWorld3D::releasePhysXObjects() {
+    // Meshes are PxPhysics objects - release them before PxPhysics goes
+    m_meshCache.reset();
     
     // Release controller manager first
     if (m_controllerManager) { m_controllerManager->release(); m_controllerManager = nullptr; }
     
-    // Release PhysX objects in order
+    // Release this world's PhysX objects, then its reference to the shared core
     if (m_scene) { m_scene->release(); m_scene = nullptr; }
     if (m_dispatcher) { m_dispatcher->release(); m_dispatcher = nullptr; }
     if (m_defaultMaterial) { m_defaultMaterial->release(); m_defaultMaterial = nullptr; }
-    if (m_physics) { m_physics->release(); m_physics = nullptr; }
-    if (m_pvd) { m_pvd->release(); m_pvd = nullptr; }
-    if (m_cudaContext) { m_cudaContext->release(); m_cudaContext = nullptr; }
-    if (m_foundation) { m_foundation->release(); m_foundation = nullptr; }
-    
-    m_initialized = false;
-    std::cout << "[PhysicsWorld3D] Shutdown complete" << std::endl;
+    releaseSharedPhysX();
 }
 
 void PhysicsWorld3D::step(float deltaTime) {
+    beginStep(deltaTime);
+    endStep(true);
+}
+
+void PhysicsWorld3D::beginStep(float deltaTime) {
     if (!m_initialized || !m_scene) return;
     
+    // Finish a step the caller never ended - simulate() fails otherwise
+    if (m_stepRunning) {
+        endStep(true);
+    }
+    
     // Clamp delta time
     float clampedDt = std::min(deltaTime, 1.0f / 30.0f);
+    if (clampedDt <= 0.0f) return;
+    
+    flushPendingAggregates();
+    
+    m_stepRunning = m_scene->simulate(clampedDt);
+}
+
+bool PhysicsWorld3D::endStep(bool block) {
+    if (!m_stepRunning) return true;
+    
+    if (!m_scene->fetchResults(block)) {
+        return false;
+    }
+    m_stepRunning = false;
     
-    m_scene->simulate(clampedDt);
-    m_scene->fetchResults(true);
+    dispatchActiveActors();
+    return true;
+}
+
+void PhysicsWorld3D::dispatchActiveActors() {
+    PxU32 count = 0;
+    PxActor** actors = m_scene->getActiveActors(count);
+    m_activeActorCount = static_cast<int>(count);
+    
+    if (m_moveListenerCount == 0) return;
+    
+    // Listeners may destroy bodies; destroyBody() defers those until the walk is done,
+    // so neither the active-actor buffer nor an owner is freed under the loop
+    m_dispatchingMoves = true;
+    for (PxU32 i = 0; i < count; i++) {
+        BodyOwner3D* owner = getBodyOwner(actors[i]);
+        if (!owner || !owner->moveListener) continue;
+        
+        // Only rigid actors carry a BodyOwner3D
+        PxTransform pose = static_cast<PxRigidActor*>(actors[i])->getGlobalPose();
+        owner->moveListener->onBodyMoved(glm::vec3(pose.p.x, pose.p.y, pose.p.z),
+                                         glm::quat(pose.q.w, pose.q.x, pose.q.y, pose.q.z));
+    }
+    m_dispatchingMoves = false;
+    
+    std::vector<PxRigidActor*> deferred;
+    deferred.swap(m_deferredDestroys);
+    for (PxRigidActor* body : deferred) {
+        destroyBody(body);
+    }
+}
+
+void PhysicsWorld3D::setMoveListener(PxRigidActor* body, BodyMoveListener3D* listener) {
+    BodyOwner3D* owner = getBodyOwner(body);
+    if (!owner) return;
+    
+    m_moveListenerCount += (listener ? 1 : 0) - (owner->moveListener ? 1 : 0);
+    owner->moveListener = listener;
+}
+
+PhysicsWorld3D::BodyOwner3D* PhysicsWorld3D::getBodyOwner(const PxActor* body) {
+    // Actors created elsewhere (character controllers) leave userData null
+    return body ? static_cast<BodyOwner3D*>(body->userData) : nullptr;
+}
+
+void* PhysicsWorld3D::getBodyUserData(const PxActor* body) {
+    BodyOwner3D* owner = getBodyOwner(body);
+    return owner ? owner->userData : nullptr;
 }
 
 // ============================================================================
@@ -237,7 +480,7 @@ PxRigidDynamic* PhysicsWorld3D::createDynamicBody(const BodyDef3D& def) {
         body->setAngularDamping(def.angularDamping);
         body->setLinearVelocity(PxVec3(def.linearVelocity.x, def.linearVelocity.y, def.linearVelocity.z));
         body->setActorFlag(PxActorFlag::eDISABLE_GRAVITY, !def.useGravity);
-        body->userData = def.userData;
+        body->userData = new BodyOwner3D{def.userData, nullptr};
         
         m_scene->addActor(*body);
         m_bodies.push_back(body);
@@ -253,7 +496,7 @@ PxRigidStatic* PhysicsWorld3D::createStaticBody(const glm::vec3& position, void*
     PxRigidStatic* body = m_physics->createRigidStatic(transform);
     
     if (body) {
-        body->userData = userData;
+        body->userData = new BodyOwner3D{userData, nullptr};
         m_scene->addActor(*body);
         m_bodies.push_back(body);
     }
@@ -264,15 +507,96 @@ PxRigidStatic* PhysicsWorld3D::createStaticBody(const glm::vec3& position, void*
 void PhysicsWorld3D::destroyBody(PxRigidActor* body) {
     if (!body || !m_scene) return;
     
+    // Destroyed from a move listener - mute it now, release after dispatch
+    if (m_dispatchingMoves) {
+        if (BodyOwner3D* owner = getBodyOwner(body)) {
+            if (owner->moveListener) m_moveListenerCount--;
+            owner->moveListener = nullptr;
+        }
+        if (std::find(m_deferredDestroys.begin(), m_deferredDestroys.end(), body) == m_deferredDestroys.end()) {
+            m_deferredDestroys.push_back(body);
+        }
+        return;
+    }
+    
+    // release() isn't buffered like other writes - finish the step first
+    endStep(true);
+    
     auto it = std::find(m_bodies.begin(), m_bodies.end(), body);
     if (it != m_bodies.end()) {
         m_bodies.erase(it);
     }
+    m_pendingAggregates.erase(std::remove(m_pendingAggregates.begin(), m_pendingAggregates.end(), body),
+                              m_pendingAggregates.end());
     
-    m_scene->removeActor(*body);
+    removeBodyFromScene(body);
+    releaseBody(body);
+}
+
+void PhysicsWorld3D::releaseBody(PxRigidActor* body) {
+    if (BodyOwner3D* owner = getBodyOwner(body)) {
+        if (owner->moveListener) m_moveListenerCount--;
+        delete owner;
+        body->userData = nullptr;
+    }
     body->release();
 }
 
+void PhysicsWorld3D::removeBodyFromScene(PxRigidActor* body) {
+    auto it = m_aggregates.find(body);
+    if (it == m_aggregates.end()) {
+        m_scene->removeActor(*body);
+        return;
+    }
+    
+    // Removing the aggregate takes its actor out of the scene as well
+    m_scene->removeAggregate(*it->second);
+    it->second->release();
+    m_aggregates.erase(it);
+}
+
+// ============================================================================
+// AGGREGATES
+// ============================================================================
+
+void PhysicsWorld3D::onShapeAttached(PxRigidActor* body) {
+    if (m_settings.aggregateMinShapes <= 0) return;
+    if (body->getAggregate() || m_aggregates.count(body)) return;
+    if (static_cast<int>(body->getNbShapes()) < m_settings.aggregateMinShapes) return;
+    
+    if (std::find(m_pendingAggregates.begin(), m_pendingAggregates.end(), body) == m_pendingAggregates.end()) {
+        m_pendingAggregates.push_back(body);
+    }
+}
+
+void PhysicsWorld3D::flushPendingAggregates() {
+    if (m_pendingAggregates.empty()) return;
+    
+    for (PxRigidActor* body : m_pendingAggregates) {
+        // Room for shapes attached later; an aggregate can't grow
+        PxU32 maxShapes = std::max<PxU32>(body->getNbShapes() * 2, 16);
+        
+        PxAggregateType::Enum type = PxAggregateType::eGENERIC;
+        if (body->is<PxRigidStatic>()) {
+            type = PxAggregateType::eSTATIC;
+        } else if (PxRigidDynamic* dynamic = body->is<PxRigidDynamic>()) {
+            if (dynamic->getRigidBodyFlags() & PxRigidBodyFlag::eKINEMATIC) {
+                type = PxAggregateType::eKINEMATIC;
+            }
+        }
+        
+        PxAggregate* aggregate = m_physics->createAggregate(1, maxShapes, PxGetAggregateFilterHint(type, false));
+        if (!aggregate) continue;
+        
+        // An actor already in a scene can't join an aggregate
+        m_scene->removeActor(*body, false);
+        aggregate->addActor(*body);
+        m_scene->addAggregate(*aggregate);
+        m_aggregates[body] = aggregate;
+    }
+    m_pendingAggregates.clear();
+}
+
 // ============================================================================
 // SHAPES
 // ============================================================================
@@ -288,6 +612,7 @@ PxShape* PhysicsWorld3D::addBoxShape(PxRigidActor* body, const glm::vec3& halfEx
     
     if (shape) {
         body->attachShape(*shape);
+        onShapeAttached(body);
         shape->release();  // Decrement reference, body now owns it
     }
     
@@ -303,6 +628,7 @@ PxShape* PhysicsWorld3D::addSphereShape(PxRigidActor* body, float radius) {
     
     if (shape) {
         body->attachShape(*shape);
+        onShapeAttached(body);
         shape->release();
     }
     
@@ -318,6 +644,47 @@ PxShape* PhysicsWorld3D::addCapsuleShape(PxRigidActor* body, float radius, float
     
     if (shape) {
         body->attachShape(*shape);
+        onShapeAttached(body);
+        shape->release();
+    }
+    
+    return shape;
+}
+
+PxShape* PhysicsWorld3D::addTriangleMeshShape(PxRigidActor* body, const CollisionMeshData& mesh,
+                                              const glm::vec3& scale) {
+    if (!body || !m_physics || !m_defaultMaterial || !m_meshCache) return nullptr;
+    
+    PxTriangleMesh* triangleMesh = m_meshCache->getTriangleMesh(mesh);
+    if (!triangleMesh) return nullptr;
+    
+    PxTriangleMeshGeometry geometry(triangleMesh, PxMeshScale(PxVec3(scale.x, scale.y, scale.z)));
+    PxShapeFlags shapeFlags = PxShapeFlag::eSIMULATION_SHAPE | PxShapeFlag::eSCENE_QUERY_SHAPE;
+    PxShape* shape = m_physics->createShape(geometry, *m_defaultMaterial, true, shapeFlags);
+    
+    if (shape) {
+        body->attachShape(*shape);
+        onShapeAttached(body);
+        shape->release();
+    }
+    
+    return shape;
+}
+
+PxShape* PhysicsWorld3D::addConvexMeshShape(PxRigidActor* body, const CollisionMeshData& mesh,
+                                            const glm::vec3& scale) {
+    if (!body || !m_physics || !m_defaultMaterial || !m_meshCache) return nullptr;
+    
+    PxConvexMesh* convexMesh = m_meshCache->getConvexMesh(mesh);
+    if (!convexMesh) return nullptr;
+    
+    PxConvexMeshGeometry geometry(convexMesh, PxMeshScale(PxVec3(scale.x, scale.y, scale.z)));
+    PxShapeFlags shapeFlags = PxShapeFlag::eSIMULATION_SHAPE | PxShapeFlag::eSCENE_QUERY_SHAPE;
+    PxShape* shape = m_physics->createShape(geometry, *m_defaultMaterial, true, shapeFlags);
+    
+    if (shape) {
+        body->attachShape(*shape);
+        onShapeAttached(body);
         shape->release();
     }
     
@@ -372,7 +739,7 @@ PhysicsWorld3D::RaycastResult3D PhysicsWorld3D::raycast(const glm::vec3& origin,
     
     PxVec3 pxOrigin(origin.x, origin.y, origin.z);
     PxVec3 pxDir(direction.x, direction.y, direction.z);
-    pxDir.normalize();
+    if (pxDir.normalize() < 1e-6f) return result;  // No direction - PhysX needs a unit vector
     
     PxRaycastBuffer hit;
     if (m_scene->raycast(pxOrigin, pxDir, maxDistance, hit)) {
@@ -386,5 +753,287 @@ PhysicsWorld3D::RaycastResult3D PhysicsWorld3D::raycast(const glm::vec3& origin,
     return result;
 }
 
+// ============================================================================
+// SNAPSHOT
+// ============================================================================
+
+void PhysicsWorld3D::captureSnapshot(WorldSnapshot3D& out) {
+    out.clear();
+    if (!m_scene) return;
+    
+    // Poses aren't readable while a step is in flight
+    endStep(true);
+    
+    out.reserve(m_bodies.size());
+    for (PxRigidActor* actor : m_bodies) {
+        PxTransform pose = actor->getGlobalPose();
+        
+        BodySnapshot3D body;
+        body.actor = actor;
+        body.position = glm::vec3(pose.p.x, pose.p.y, pose.p.z);
+        body.rotation = glm::quat(pose.q.w, pose.q.x, pose.q.y, pose.q.z);
+        
+        if (PxRigidDynamic* dynamic = actor->is<PxRigidDynamic>()) {
+            if (!(dynamic->getRigidBodyFlags() & PxRigidBodyFlag::eKINEMATIC)) {
+                PxVec3 linear = dynamic->getLinearVelocity();
+                PxVec3 angular = dynamic->getAngularVelocity();
+                body.linearVelocity = glm::vec3(linear.x, linear.y, linear.z);
+                body.angularVelocity = glm::vec3(angular.x, angular.y, angular.z);
+                body.sleeping = dynamic->isSleeping();
+            }
+        }
+        out.push_back(body);
+    }
+}
+
+void PhysicsWorld3D::restoreSnapshot(const WorldSnapshot3D& snapshot) {
+    if (!m_scene) return;
+    
+    endStep(true);
+    
+    std::unordered_set<PxRigidActor*> alive(m_bodies.begin(), m_bodies.end());
+    
+    for (const BodySnapshot3D& body : snapshot) {
+        if (!alive.count(body.actor)) continue;
+        
+        PxTransform pose(PxVec3(body.position.x, body.position.y, body.position.z),
+                         PxQuat(body.rotation.x, body.rotation.y, body.rotation.z, body.rotation.w));
+        
+        PxRigidDynamic* dynamic = body.actor->is<PxRigidDynamic>();
+        if (!dynamic || (dynamic->getRigidBodyFlags() & PxRigidBodyFlag::eKINEMATIC)) {
+            body.actor->setGlobalPose(pose);
+            continue;
+        }
+        
+        dynamic->setGlobalPose(pose, false);
+        dynamic->setLinearVelocity(PxVec3(body.linearVelocity.x, body.linearVelocity.y, body.linearVelocity.z), false);
+        dynamic->setAngularVelocity(PxVec3(body.angularVelocity.x, body.angularVelocity.y, body.angularVelocity.z), false);
+        dynamic->clearForce();
+        dynamic->clearTorque();
+        
+        if (body.sleeping) {
+            dynamic->putToSleep();
+        } else {
+            dynamic->wakeUp();
+        }
+    }
+}
+
+// ============================================================================
+// BATCHED QUERIES
+// ============================================================================
+
+struct PhysicsWorld3D::QueryScratch {
+    std::vector<PxRaycastHit> rayHits;
+    std::vector<PxSweepHit> sweepHits;
+    std::vector<PxOverlapHit> overlapHits;
+};
+
+namespace {
+
+PxVec3 toPx(const glm::vec3& v) {
+    return PxVec3(v.x, v.y, v.z);
+}
+
+glm::vec3 fromPx(const PxVec3& v) {
+    return glm::vec3(v.x, v.y, v.z);
+}
+
+PxTransform toPxPose(const PhysicsWorld3D::QueryShape3D& shape) {
+    glm::quat q(shape.rotation);
+    return PxTransform(toPx(shape.position), PxQuat(q.x, q.y, q.z, q.w));
+}
+
+PxGeometryHolder toPxGeometry(const PhysicsWorld3D::QueryShape3D& shape) {
+    using Type = PhysicsWorld3D::ShapeDef3D::Type;
+    switch (shape.type) {
+        case Type::Sphere:
+            return PxGeometryHolder(PxSphereGeometry(shape.radius));
+        case Type::Capsule:
+            return PxGeometryHolder(PxCapsuleGeometry(shape.radius, shape.halfHeight));
+        case Type::Box:
+        default:
+            return PxGeometryHolder(PxBoxGeometry(toPx(shape.halfExtents)));
+    }
+}
+
+PxQueryFilterData makeFilterData(uint32_t mask, bool allHits) {
+    PxQueryFilterData filterData;
+    filterData.data = PxFilterData(mask, 0, 0, 0);
+    filterData.flags = PxQueryFlag::eSTATIC | PxQueryFlag::eDYNAMIC;
+    if (allHits) {
+        // Report everything as touching so PhysX fills the touch buffer
+        filterData.flags |= PxQueryFlag::eNO_BLOCK;
+    }
+    return filterData;
+}
+
+template<typename PxHit>
+void writeHit(const PxHit& in, PhysicsWorld3D::QueryHit3D& out) {
+    out.actor = in.actor;
+    out.shape = in.shape;
+    out.point = fromPx(in.position);
+    out.normal = fromPx(in.normal);
+    out.distance = in.distance;
+}
+
+/**
+ * @brief Copy up to maxHits touches sorted by distance
+ * The touch buffer holds maxHits + 1 so overflow can be detected. On
+ * overflow PhysX has already dropped touches in no particular order, so
+ * the copied hits are not guaranteed to be the nearest - only flagged.
+ */
+template<typename PxHit>
+void writeTouches(std::vector<PxHit>& touches, int touchCount, int maxHits,
+                  PhysicsWorld3D::QueryHit3D* out, PhysicsWorld3D::QueryResult3D& result) {
+    std::sort(touches.begin(), touches.begin() + touchCount,
+        [](const PxHit& a, const PxHit& b) { return a.distance < b.distance; });
+    
+    result.hitCount = std::min(touchCount, maxHits);
+    result.truncated = touchCount > maxHits;
+    for (int i = 0; i < result.hitCount; i++) {
+        writeHit(touches[i], out[i]);
+    }
+}
+
+} // namespace
+
+void PhysicsWorld3D::runQueryBatch(int count, int maxHitsPerQuery, bool parallel,
+                                   const std::function<void(int, QueryScratch&)>& runQuery) const {
+    if (parallel && !m_queryScheduler) {
+        m_queryScheduler = TaskScheduler::acquireShared(std::max(1, m_dispatcherThreads) + 1);
+    }
+    
+    int workerCount = parallel ? m_queryScheduler->getWorkerCount() : 1;
+    while (static_cast<int>(m_queryScratch.size()) < workerCount) {
+        m_queryScratch.push_back(std::make_unique<QueryScratch>());
+    }
+    
+    // One extra slot so a full buffer can be told apart from an overflow
+    size_t touchCapacity = static_cast<size_t>(maxHitsPerQuery) + 1;
+    for (int i = 0; i < workerCount; i++) {
+        QueryScratch& scratch = *m_queryScratch[i];
+        if (scratch.rayHits.size() < touchCapacity) {
+            scratch.rayHits.resize(touchCapacity);
+            scratch.sweepHits.resize(touchCapacity);
+            scratch.overlapHits.resize(touchCapacity);
+        }
+    }
+    
+    if (!parallel) {
+        for (int i = 0; i < count; i++) {
+            runQuery(i, *m_queryScratch[0]);
+        }
+        return;
+    }
+    
+    TaskScheduler::Task* task = m_queryScheduler->parallelFor(count, 8,
+        [this, &runQuery](int start, int end, int workerIndex) {
+            QueryScratch& scratch = *m_queryScratch[workerIndex];
+            for (int i = start; i < end; i++) {
+                runQuery(i, scratch);
+            }
+        });
+    m_queryScheduler->wait(task);
+}
+
+void PhysicsWorld3D::raycastBatch(const RayQuery3D* queries, int count, QueryMode3D mode,
+                                  QueryResult3D* results, QueryHit3D* hits, int maxHitsPerQuery,
+                                  bool parallel) const {
+    if (count <= 0) return;
+    for (int i = 0; i < count; i++) results[i] = QueryResult3D{};
+    if (!m_scene || maxHitsPerQuery <= 0) return;
+    
+    const bool allHits = mode == QueryMode3D::All;
+    
+    runQueryBatch(count, maxHitsPerQuery, parallel, [&](int i, QueryScratch& scratch) {
+        const RayQuery3D& query = queries[i];
+        QueryHit3D* out = hits + i * maxHitsPerQuery;
+        
+        PxVec3 dir = toPx(query.direction);
+        if (dir.normalize() < 1e-6f) return;  // Zero-length direction - left as a miss
+        
+        if (allHits) {
+            PxRaycastBuffer buffer(scratch.rayHits.data(), maxHitsPerQuery + 1);
+            m_scene->raycast(toPx(query.origin), dir, query.maxDistance, buffer,
+                             PxHitFlag::eDEFAULT, makeFilterData(query.mask, true));
+            writeTouches(scratch.rayHits, buffer.getNbTouches(), maxHitsPerQuery, out, results[i]);
+        } else {
+            PxRaycastBuffer buffer;
+            if (m_scene->raycast(toPx(query.origin), dir, query.maxDistance, buffer,
+                                 PxHitFlag::eDEFAULT, makeFilterData(query.mask, false)) && buffer.hasBlock) {
+                writeHit(buffer.block, out[0]);
+                results[i].hitCount = 1;
+            }
+        }
+    });
+}
+
+void PhysicsWorld3D::sweepBatch(const SweepQuery3D* queries, int count, QueryMode3D mode,
+                                QueryResult3D* results, QueryHit3D* hits, int maxHitsPerQuery,
+                                bool parallel) const {
+    if (count <= 0) return;
+    for (int i = 0; i < count; i++) results[i] = QueryResult3D{};
+    if (!m_scene || maxHitsPerQuery <= 0) return;
+    
+    const bool allHits = mode == QueryMode3D::All;
+    
+    runQueryBatch(count, maxHitsPerQuery, parallel, [&](int i, QueryScratch& scratch) {
+        const SweepQuery3D& query = queries[i];
+        QueryHit3D* out = hits + i * maxHitsPerQuery;
+        
+        PxGeometryHolder geometry = toPxGeometry(query.shape);
+        PxTransform pose = toPxPose(query.shape);
+        PxVec3 dir = toPx(query.direction);
+        if (dir.normalize() < 1e-6f) return;  // Zero-length direction - left as a miss
+        
+        if (allHits) {
+            PxSweepBuffer buffer(scratch.sweepHits.data(), maxHitsPerQuery + 1);
+            m_scene->sweep(geometry.any(), pose, dir, query.maxDistance, buffer,
+                           PxHitFlag::eDEFAULT, makeFilterData(query.mask, true));
+            writeTouches(scratch.sweepHits, buffer.getNbTouches(), maxHitsPerQuery, out, results[i]);
+        } else {
+            PxSweepBuffer buffer;
+            if (m_scene->sweep(geometry.any(), pose, dir, query.maxDistance, buffer,
+                               PxHitFlag::eDEFAULT, makeFilterData(query.mask, false)) && buffer.hasBlock) {
+                writeHit(buffer.block, out[0]);
+                results[i].hitCount = 1;
+            }
+        }
+    });
+}
+
+void PhysicsWorld3D::overlapBatch(const OverlapQuery3D* queries, int count,
+                                  QueryResult3D* results, QueryHit3D* hits, int maxHitsPerQuery,
+                                  bool parallel) const {
+    if (count <= 0) return;
+    for (int i = 0; i < count; i++) results[i] = QueryResult3D{};
+    if (!m_scene || maxHitsPerQuery <= 0) return;
+    
+    runQueryBatch(count, maxHitsPerQuery, parallel, [&](int i, QueryScratch& scratch) {
+        const OverlapQuery3D& query = queries[i];
+        QueryHit3D* out = hits + i * maxHitsPerQuery;
+        
+        PxGeometryHolder geometry = toPxGeometry(query.shape);
+        PxOverlapBuffer buffer(scratch.overlapHits.data(), maxHitsPerQuery + 1);
+        m_scene->overlap(geometry.any(), toPxPose(query.shape), buffer,
+                         makeFilterData(query.mask, true));
+        
+        int touchCount = static_cast<int>(buffer.getNbTouches());
+        results[i].hitCount = std::min(touchCount, maxHitsPerQuery);
+        results[i].truncated = touchCount > maxHitsPerQuery;
+        for (int h = 0; h < results[i].hitCount; h++) {
+            out[h] = QueryHit3D{};
+            out[h].actor = scratch.overlapHits[h].actor;
+            out[h].shape = scratch.overlapHits[h].shape;
+        }
+    });
+}
+
+void PhysicsWorld3D::setShapeQueryCategory(PxShape* shape, uint32_t category) {
+    if (!shape) return;
+    shape->setQueryFilterData(PxFilterData(category, 0, 0, 0));
+}
+
 } // namespace physics
 } // namespace engine
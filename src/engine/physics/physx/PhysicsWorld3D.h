@@ -8,9 +8,15 @@
 #pragma once
 
 #include "engine/physics/IPhysicsWorld.h"
+#include "CookedMeshCache.h"
 #include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
 #include <vector>
 #include <memory>
+#include <functional>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
 
 // Forward declare PhysX types to avoid header pollution
 namespace physx {
@@ -24,13 +30,78 @@ namespace physx {
     class PxRigidDynamic;
     class PxRigidStatic;
     class PxShape;
+    class PxActor;
     class PxRigidActor;
     class PxControllerManager;
+    class PxAggregate;
 }
 
 namespace engine {
+
+class TaskScheduler;
+
 namespace physics {
 
+/** @brief PhysX broadphase algorithm (PxBroadPhaseType) */
+enum class BroadPhase3D {
+    SAP,    // Sweep and prune - good when few bodies move
+    MBP,    // Multi box pruning - needs world bounds, bodies outside get no collisions
+    ABP,    // Automatic box pruning
+    PABP    // Parallel ABP (PhysX default)
+};
+
+/** @brief Scene-query pruning structure (PxPruningStructureType) */
+enum class PruningStructure3D {
+    None,               // Flat list - cheap updates, linear queries (dynamic structure only)
+    DynamicAABBTree,    // Tree rebuilt in the background (PhysX default)
+    StaticAABBTree      // Tree rebuilt on change - for actors that rarely move
+};
+
+/**
+ * @brief Creation-time options for PhysicsWorld3D
+ */
+struct WorldSettings3D {
+    int dispatcherThreads = 0;  // PhysX worker threads (0 = hardware threads - 1, at least 1)
+    bool probeCuda = true;      // false skips PxCreateCudaContextManager (CPU-only machines)
+    std::string meshCacheDirectory = "cache/physx";  // Cooked mesh files ("" = don't touch disk)
+    
+    // Broadphase and scene queries - compare combinations with runBroadphaseBenchmark3D()
+    BroadPhase3D broadPhase = BroadPhase3D::PABP;  // Replaced by the GPU broadphase when CUDA is used
+    glm::vec3 mbpWorldMin{-500.0f, -100.0f, -500.0f};  // MBP only: bounds split into regions
+    glm::vec3 mbpWorldMax{500.0f, 100.0f, 500.0f};
+    int mbpSubdivisions = 4;    // MBP only: regions per axis on the XZ plane (1-16)
+    PruningStructure3D staticStructure = PruningStructure3D::DynamicAABBTree;   // None not allowed
+    PruningStructure3D dynamicStructure = PruningStructure3D::DynamicAABBTree;
+    int dynamicTreeRebuildRateHint = 100;  // Frames for a full background rebuild (min 4)
+    int aggregateMinShapes = 0; // Actors with at least this many shapes get their own aggregate (0 = off)
+};
+
+/**
+ * @brief Pose, velocity and sleep state of one body (see PhysicsWorld3D::captureSnapshot)
+ */
+struct BodySnapshot3D {
+    physx::PxRigidActor* actor = nullptr;
+    glm::vec3 position{0, 0, 0};
+    glm::quat rotation{1, 0, 0, 0};
+    glm::vec3 linearVelocity{0, 0, 0};
+    glm::vec3 angularVelocity{0, 0, 0};
+    bool sleeping = false;
+};
+
+using WorldSnapshot3D = std::vector<BodySnapshot3D>;
+
+/**
+ * @brief Receives the new pose of a body PhysX moved during the last step
+ *
+ * Registered per body with PhysicsWorld3D::setMoveListener. Sleeping and
+ * static bodies are not reported, so nothing runs for them.
+ */
+class BodyMoveListener3D {
+public:
+    virtual ~BodyMoveListener3D() = default;
+    virtual void onBodyMoved(const glm::vec3& position, const glm::quat& rotation) = 0;
+};
+
 /**
  * @brief 3D Physics world using NVIDIA PhysX
  * 
@@ -38,6 +109,11 @@ namespace physics {
  *   auto world = std::make_unique<PhysicsWorld3D>();
  *   world->initialize();
  *   world->step(deltaTime);
+ * 
+ * Or overlap the simulation with game logic/rendering:
+ *   world->beginStep(deltaTime);  // returns immediately
+ *   ... render ...
+ *   world->endStep();             // waits for results
  */
 class PhysicsWorld3D : public IPhysicsWorld {
 public:
@@ -49,9 +125,48 @@ public:
     // ========================================================================
     
     void initialize() override;
+    
+    /**
+     * @brief Create the scene with the given options
+     * @return false if any PhysX object could not be created - the world
+     *         stays uninitialized and holds nothing
+     *
+     * All worlds in the process share one PxFoundation/PxPhysics (PhysX
+     * allows a single foundation); each world owns its own scene.
+     */
+    bool initialize(const WorldSettings3D& settings);
     void shutdown() override;
+    
+    /** @brief Simulate and wait for the results (beginStep + endStep) */
     void step(float deltaTime) override;
     
+    // ========================================================================
+    // ASYNC STEPPING
+    // ========================================================================
+    
+    /**
+     * @brief Start simulating on the dispatcher threads and return
+     * 
+     * Until endStep() returns true, don't create/destroy bodies, move
+     * controllers or change poses - PhysX rejects scene writes while
+     * it simulates.
+     */
+    void beginStep(float deltaTime);
+    
+    /**
+     * @brief Fetch the results of beginStep()
+     * @param block false = only poll, returns false if still running
+     * @return true when no step is running anymore
+     */
+    bool endStep(bool block = true);
+    
+    bool isStepRunning() const { return m_stepRunning; }
+    
+    const WorldSettings3D& getSettings() const { return m_settings; }
+    
+    /** @brief Threads actually used by the CPU dispatcher */
+    int getDispatcherThreadCount() const { return m_dispatcherThreads; }
+    
     PhysicsDimension getDimension() const override { return PhysicsDimension::Physics3D; }
     bool isInitialized() const override { return m_initialized; }
     
@@ -81,6 +196,14 @@ public:
     physx::PxRigidStatic* createStaticBody(const glm::vec3& position, void* userData = nullptr);
     void destroyBody(physx::PxRigidActor* body);
     
+    /**
+     * @brief userData given at creation (nullptr for bodies not created here)
+     *
+     * PxActor::userData of bodies created by this world points to a
+     * world-owned record - don't overwrite it, and read userData here.
+     */
+    static void* getBodyUserData(const physx::PxActor* body);
+    
     // ========================================================================
     // 3D-SPECIFIC: SHAPES
     // ========================================================================
@@ -101,6 +224,19 @@ public:
     physx::PxShape* addSphereShape(physx::PxRigidActor* body, float radius);
     physx::PxShape* addCapsuleShape(physx::PxRigidActor* body, float radius, float halfHeight);
     
+    /**
+     * @brief Mesh shapes, cooked through getMeshCache()
+     * Triangle meshes can't be simulated on dynamic bodies - use a convex
+     * hull there. Return nullptr if the mesh couldn't be cooked.
+     */
+    physx::PxShape* addTriangleMeshShape(physx::PxRigidActor* body, const CollisionMeshData& mesh,
+                                         const glm::vec3& scale = glm::vec3(1.0f));
+    physx::PxShape* addConvexMeshShape(physx::PxRigidActor* body, const CollisionMeshData& mesh,
+                                       const glm::vec3& scale = glm::vec3(1.0f));
+    
+    /** @brief Cooked mesh cache, nullptr before initialize() */
+    CookedMeshCache* getMeshCache() const { return m_meshCache.get(); }
+    
     // ========================================================================
     // 3D-SPECIFIC: QUERIES
     // ========================================================================
@@ -114,6 +250,38 @@ public:
     void addForce(physx::PxRigidDynamic* body, const glm::vec3& force);
     void addImpulse(physx::PxRigidDynamic* body, const glm::vec3& impulse);
     
+    // ========================================================================
+    // 3D-SPECIFIC: ACTIVE ACTORS
+    // ========================================================================
+    
+    /**
+     * @brief Get called from endStep() whenever PhysX reports the body as active
+     * nullptr removes the listener. destroyBody() removes it as well; called
+     * from a listener, the body itself is released once dispatch finishes.
+     * Only bodies created by this world can have a listener.
+     */
+    void setMoveListener(physx::PxRigidActor* body, BodyMoveListener3D* listener);
+    
+    /** @brief Bodies PhysX reported as moved by the last fetched step */
+    int getActiveActorCount() const { return m_activeActorCount; }
+    
+    /** @brief Actors wrapped in their own aggregate (see WorldSettings3D::aggregateMinShapes) */
+    int getAggregateCount() const { return static_cast<int>(m_aggregates.size()); }
+    
+    // ========================================================================
+    // 3D-SPECIFIC: SNAPSHOT
+    // ========================================================================
+    
+    /** @brief Record every tracked body (controllers excluded) */
+    void captureSnapshot(WorldSnapshot3D& out);
+    
+    /**
+     * @brief Put bodies back to a snapshot, clearing pending forces
+     * Bodies destroyed since the capture are skipped, bodies created since
+     * are left as they are.
+     */
+    void restoreSnapshot(const WorldSnapshot3D& snapshot);
+    
     // ========================================================================
     // 3D-SPECIFIC: RAYCASTING
     // ========================================================================
@@ -128,6 +296,82 @@ public:
     
     RaycastResult3D raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance) const;
     
+    // ========================================================================
+    // 3D-SPECIFIC: BATCHED QUERIES
+    // ========================================================================
+    // Output goes to caller-owned arrays: results[count] and
+    // hits[count * maxHitsPerQuery], hits for query i starting at
+    // i * maxHitsPerQuery. A mask of 0 matches every shape; otherwise a
+    // shape matches when (mask & its query category) != 0 - see
+    // setShapeQueryCategory(). parallel = true splits the batch across a
+    // query worker pool. Don't write to the scene during a batch.
+    
+    // All mode and overlaps: when more shapes match than fit, PhysX keeps
+    // an arbitrary subset - not the nearest ones - and truncated is set.
+    // Raise maxHitsPerQuery if the complete or nearest set matters.
+    
+    enum class QueryMode3D {
+        Closest,    // At most one hit, the nearest blocking hit
+        All         // Up to maxHitsPerQuery hits sorted by distance (see truncated)
+    };
+    
+    /** @brief Box, sphere or capsule (capsule axis along X, like addCapsuleShape) */
+    struct QueryShape3D {
+        ShapeDef3D::Type type = ShapeDef3D::Type::Box;
+        glm::vec3 halfExtents{0.5f, 0.5f, 0.5f};
+        float radius = 0.5f;
+        float halfHeight = 0.5f;
+        glm::vec3 position{0, 0, 0};
+        glm::vec3 rotation{0, 0, 0};    // Euler angles (radians)
+    };
+    
+    struct RayQuery3D {
+        glm::vec3 origin{0, 0, 0};
+        glm::vec3 direction{0, 0, -1};   // Normalized internally, zero length = miss
+        float maxDistance = 100.0f;
+        uint32_t mask = 0;
+    };
+    
+    struct SweepQuery3D {
+        QueryShape3D shape;
+        glm::vec3 direction{0, 0, -1};   // Normalized internally, zero length = miss
+        float maxDistance = 100.0f;
+        uint32_t mask = 0;
+    };
+    
+    struct OverlapQuery3D {
+        QueryShape3D shape;
+        uint32_t mask = 0;
+    };
+    
+    struct QueryHit3D {
+        physx::PxRigidActor* actor = nullptr;
+        physx::PxShape* shape = nullptr;
+        glm::vec3 point{0, 0, 0};       // Unused for overlaps
+        glm::vec3 normal{0, 0, 0};
+        float distance = 0.0f;
+    };
+    
+    struct QueryResult3D {
+        int hitCount = 0;
+        bool truncated = false;         // Touch buffer overflowed - hits are an arbitrary subset
+    };
+    
+    void raycastBatch(const RayQuery3D* queries, int count, QueryMode3D mode,
+                      QueryResult3D* results, QueryHit3D* hits, int maxHitsPerQuery,
+                      bool parallel = false) const;
+    
+    void sweepBatch(const SweepQuery3D* queries, int count, QueryMode3D mode,
+                    QueryResult3D* results, QueryHit3D* hits, int maxHitsPerQuery,
+                    bool parallel = false) const;
+    
+    void overlapBatch(const OverlapQuery3D* queries, int count,
+                      QueryResult3D* results, QueryHit3D* hits, int maxHitsPerQuery,
+                      bool parallel = false) const;
+    
+    /** @brief Category bits matched against query masks (0 = only hit by unmasked queries) */
+    void setShapeQueryCategory(physx::PxShape* shape, uint32_t category);
+    
     // ========================================================================
     // GPU ACCELERATION
     // ========================================================================
@@ -144,13 +388,21 @@ public:
     physx::PxMaterial* getDefaultMaterial() const { return m_defaultMaterial; }
     
 private:
-    void initializeFoundation();
-    void initializeCuda();
-    void initializePhysics();
-    void initializeScene();
-    void initializePVD();  // PhysX Visual Debugger
+    bool acquireSharedPhysX();
+    void releaseSharedPhysX();
+    bool initializeWorldObjects();
+    bool initializeScene();
+    void releasePhysXObjects();
+    void dispatchActiveActors();
+    void onShapeAttached(physx::PxRigidActor* body);
+    void flushPendingAggregates();
+    void removeBodyFromScene(physx::PxRigidActor* body);
+    
+    struct QueryScratch;
+    void runQueryBatch(int count, int maxHitsPerQuery, bool parallel,
+                       const std::function<void(int index, QueryScratch& scratch)>& runQuery) const;
     
-    // PhysX core
+    // PhysX core - foundation, physics, PVD and CUDA are shared by all worlds
     physx::PxFoundation* m_foundation = nullptr;
     physx::PxPhysics* m_physics = nullptr;
     physx::PxScene* m_scene = nullptr;
@@ -161,14 +413,44 @@ private:
     physx::PxPvd* m_pvd = nullptr;
     physx::PxCudaContextManager* m_cudaContext = nullptr;
     physx::PxControllerManager* m_controllerManager = nullptr;
+    std::unique_ptr<CookedMeshCache> m_meshCache;
     
     // State
+    WorldSettings3D m_settings;
+    int m_dispatcherThreads = 0;
+    bool m_stepRunning = false;
+    int m_activeActorCount = 0;
     bool m_initialized = false;
+    bool m_ownsSharedRef = false;   // Holds a reference on the shared PhysX core
     bool m_debugDrawEnabled = false;
     glm::vec3 m_gravity{0.0f, -9.81f, 0.0f};
     
     // Track bodies for cleanup
     std::vector<physx::PxRigidActor*> m_bodies;
+    
+    // Owner of a body, stored in PxActor::userData so active-actor events
+    // reach the move listener without a lookup
+    struct BodyOwner3D {
+        void* userData = nullptr;
+        BodyMoveListener3D* moveListener = nullptr;
+    };
+    
+    static BodyOwner3D* getBodyOwner(const physx::PxActor* body);
+    void releaseBody(physx::PxRigidActor* body);
+    
+    int m_moveListenerCount = 0;    // Skip the active-actor walk when 0
+    bool m_dispatchingMoves = false;
+    std::vector<physx::PxRigidActor*> m_deferredDestroys;  // destroyBody() from a move listener
+    
+    // Multi-shape actors: one aggregate each, so the broadphase sees a single box.
+    // Queued until beginStep() so the aggregate is sized for every attached shape
+    std::unordered_map<physx::PxRigidActor*, physx::PxAggregate*> m_aggregates;
+    std::vector<physx::PxRigidActor*> m_pendingAggregates;
+    
+    // Batched queries: shared pool acquired on first parallel batch, PhysX
+    // touch buffers per worker so batches don't allocate per query
+    mutable std::shared_ptr<TaskScheduler> m_queryScheduler;
+    mutable std::vector<std::unique_ptr<QueryScratch>> m_queryScratch;
 };
 
 } // namespace physics
@@ -34,7 +34,7 @@ void AISystem::update(float deltaTime) {
     for (engine::actors::NPC* npc : m_npcs) {
         if (!npc) continue;
         
-        auto it = m_behaviors.find(npc->getName());
+        auto it = m_behaviors.find(npc->getNameId());
         if (it != m_behaviors.end()) {
             updateBehavior(npc, it->second, deltaTime);
         }
@@ -50,9 +50,7 @@ void AISystem::registerNPC(engine::actors::NPC* npc) {
         m_npcs.push_back(npc);
         
         // Skapa default behavior om ingen finns
-        if (m_behaviors.find(npc->getName()) == m_behaviors.end()) {
-            m_behaviors[npc->getName()] = Behavior{};
-        }
+        m_behaviors.try_emplace(npc->getNameId());
     }
 }
 
@@ -226,11 +224,12 @@ void AISystem::updateGoTo(engine::actors::NPC* npc, Behavior& behavior, float de
 
 void AISystem::updateSchedules() {
     for (auto& [npcId, schedule] : m_schedules) {
+        engine::Name npcName(npcId);
         for (const auto& entry : schedule.entries) {
             if (m_gameHour >= entry.startHour && m_gameHour < entry.endHour) {
                 // Hitta NPC
                 for (engine::actors::NPC* npc : m_npcs) {
-                    if (npc && npc->getName() == npcId) {
+                    if (npc && npc->getNameId() == npcName) {
                         applyScheduleEntry(npc, entry);
                         break;
                     }
@@ -262,7 +261,7 @@ void AISystem::applyScheduleEntry(engine::actors::NPC* npc, const ScheduleEntry&
         behavior.waypoints.push_back(wp);
     }
     
-    m_behaviors[npc->getName()] = behavior;
+    m_behaviors[npc->getNameId()] = behavior;
     
     // Om idle, teleportera direkt till position
     if (entry.behavior == BehaviorType::Idle) {
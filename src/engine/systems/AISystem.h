@@ -4,6 +4,7 @@
  */
 #pragma once
 
+#include "engine/core/Name.h"
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -131,7 +132,7 @@ private:
     void applyScheduleEntry(engine::actors::NPC* npc, const ScheduleEntry& entry);
     
     std::vector<engine::actors::NPC*> m_npcs;
-    std::unordered_map<std::string, Behavior> m_behaviors;
+    std::unordered_map<engine::Name, Behavior> m_behaviors;  // Keyed by NPC name
     std::unordered_map<std::string, Schedule> m_schedules;
     
     // Speltid
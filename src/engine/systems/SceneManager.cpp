@@ -23,6 +23,15 @@ void SceneManager::clearScenes() {
     m_scenes.clear();
 }
 
+engine::physics::PhysicsWorld2D* SceneManager::enablePhysics(glm::vec2 gravity, int workerCount) {
+    if (!m_physicsWorld) {
+        m_physicsWorld = std::make_unique<engine::physics::PhysicsWorld2D>();
+        m_physicsWorld->initialize(gravity, workerCount);
+        LOG_INFO("Shared physics world created");
+    }
+    return m_physicsWorld.get();
+}
+
 engine::Scene* SceneManager::getScene(const std::string& sceneId) {
     auto it = m_scenes.find(sceneId);
     if (it == m_scenes.end()) {
@@ -41,7 +50,14 @@ bool SceneManager::changeScene(const std::string& sceneId) {
     }
     
     LOG_INFO("Changing to scene: " + sceneId);
+    
+    // Scenes sharing the physics world keep their bodies - just switch
+    // which scene's bodies take part in the simulation
+    if (m_currentScene && m_currentScene != newScene) {
+        m_currentScene->setPhysicsActive(false);
+    }
     m_currentScene = newScene;
+    m_currentScene->setPhysicsActive(true);
     
     if (m_onSceneChange) {
         LOG_DEBUG("Calling onSceneChange callback");
@@ -44,6 +44,18 @@ public:
         y = m_spawnY;
     }
     
+    /**
+     * @brief Skapa den gemensamma Box2D-världen för alla scener (gör inget om den finns)
+     *
+     * Scener kopplas till världen med Scene::usePhysicsWorld(). changeScene()
+     * stänger av den gamla scenens bodies och slår på den nyas, så statisk
+     * geometri byggs en gång per scen och spelarens body kan ligga kvar.
+     */
+    engine::physics::PhysicsWorld2D* enablePhysics(glm::vec2 gravity, int workerCount = 0);
+    
+    /** @brief Gemensam fysikvärld (nullptr innan enablePhysics) */
+    engine::physics::PhysicsWorld2D* getPhysicsWorld() const { return m_physicsWorld.get(); }
+    
     /** @brief Sätt spawn-position för nästa scenebyte */
     void setSpawnPosition(float x, float y) {
         m_spawnX = x;
@@ -53,6 +65,8 @@ public:
 private:
     SceneManager() = default;
     
+    // Före m_scenes så att världen förstörs efter scenerna
+    std::unique_ptr<engine::physics::PhysicsWorld2D> m_physicsWorld;
     std::unordered_map<std::string, std::unique_ptr<engine::Scene>> m_scenes;
     engine::Scene* m_currentScene = nullptr;
     std::function<void(const std::string&)> m_onSceneChange;
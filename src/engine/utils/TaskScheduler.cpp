@@ -0,0 +1,167 @@
+/**
+ * @file TaskScheduler.cpp
+ * @brief Worker pool implementation
+ */
+#include "TaskScheduler.h"
+#include <algorithm>
+#include <map>
+
+namespace engine {
+
+namespace {
+// Scheduler and worker index of the range running on this thread, so a
+// nested parallelFor() can run inline instead of waiting on its own pool
+thread_local TaskScheduler* t_runningScheduler = nullptr;
+thread_local int t_runningWorker = 0;
+}
+
+struct TaskScheduler::Task {
+    RangeFunction function;
+    std::atomic<int> remaining{0};
+};
+
+TaskScheduler::TaskScheduler(int workerCount) {
+    if (workerCount <= 0) {
+        workerCount = getHardwareWorkerCount();
+    }
+
+    m_threads.reserve(workerCount - 1);
+    for (int i = 1; i < workerCount; ++i) {
+        m_threads.emplace_back(&TaskScheduler::workerLoop, this, i);
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_workAvailable.notify_all();
+
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+int TaskScheduler::getHardwareWorkerCount() {
+    return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+std::shared_ptr<TaskScheduler> TaskScheduler::acquireShared(int workerCount) {
+    if (workerCount <= 0) {
+        workerCount = getHardwareWorkerCount();
+    }
+
+    static std::mutex s_sharedMutex;
+    static std::map<int, std::weak_ptr<TaskScheduler>> s_shared;
+
+    std::lock_guard<std::mutex> lock(s_sharedMutex);
+    std::shared_ptr<TaskScheduler> scheduler = s_shared[workerCount].lock();
+    if (!scheduler) {
+        scheduler = std::make_shared<TaskScheduler>(workerCount);
+        s_shared[workerCount] = scheduler;
+    }
+    return scheduler;
+}
+
+TaskScheduler::Task* TaskScheduler::parallelFor(int itemCount, int minRange, RangeFunction function) {
+    if (itemCount <= 0) return nullptr;
+
+    // No background threads, or called from inside one of our own ranges:
+    // waiting here could block the thread a queued range needs
+    if (getWorkerCount() == 1 || t_runningScheduler == this) {
+        function(0, itemCount, t_runningScheduler == this ? t_runningWorker : 0);
+        return nullptr;
+    }
+
+    minRange = std::max(minRange, 1);
+    int rangeCount = std::clamp((itemCount + minRange - 1) / minRange, 1, getWorkerCount());
+
+    // A single range is still queued - Box2D enqueues one long-running
+    // item per solver worker and needs them all running at once
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    Task* task = acquireTask();
+    task->function = std::move(function);
+    task->remaining.store(rangeCount, std::memory_order_relaxed);
+
+    // Even split, the first (itemCount % rangeCount) ranges get one extra
+    int base = itemCount / rangeCount;
+    int extra = itemCount % rangeCount;
+    int start = 0;
+    for (int i = 0; i < rangeCount; ++i) {
+        int end = start + base + (i < extra ? 1 : 0);
+        m_queue.push_back({task, start, end});
+        start = end;
+    }
+
+    lock.unlock();
+    m_workAvailable.notify_all();
+    return task;
+}
+
+void TaskScheduler::wait(Task* task) {
+    if (!task) return;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (task->remaining.load(std::memory_order_acquire) > 0) {
+        if (!m_queue.empty()) {
+            Range range = m_queue.front();
+            m_queue.pop_front();
+            lock.unlock();
+            runRange(range, 0);
+            lock.lock();
+        } else {
+            m_taskDone.wait(lock);
+        }
+    }
+
+    task->function = nullptr;
+    m_freeTasks.push_back(task);
+}
+
+void TaskScheduler::workerLoop(int workerIndex) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_workAvailable.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+        if (m_stopping) return;
+
+        Range range = m_queue.front();
+        m_queue.pop_front();
+        lock.unlock();
+        runRange(range, workerIndex);
+        lock.lock();
+    }
+}
+
+void TaskScheduler::runRange(const Range& range, int workerIndex) {
+    TaskScheduler* outerScheduler = t_runningScheduler;
+    int outerWorker = t_runningWorker;
+    t_runningScheduler = this;
+    t_runningWorker = workerIndex;
+
+    range.task->function(range.start, range.end, workerIndex);
+
+    t_runningScheduler = outerScheduler;
+    t_runningWorker = outerWorker;
+
+    if (range.task->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        // Lock so the waiter can't miss the notification between its
+        // remaining check and going to sleep
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_taskDone.notify_all();
+    }
+}
+
+TaskScheduler::Task* TaskScheduler::acquireTask() {
+    if (m_freeTasks.empty()) {
+        m_tasks.push_back(std::make_unique<Task>());
+        return m_tasks.back().get();
+    }
+    Task* task = m_freeTasks.back();
+    m_freeTasks.pop_back();
+    return task;
+}
+
+} // namespace engine
@@ -0,0 +1,111 @@
+/**
+ * @file TaskScheduler.h
+ * @brief Fixed-size worker pool for parallel-for style tasks
+ *
+ * Built for Box2D's enqueueTask/finishTask callbacks but usable by any
+ * engine system that splits work into index ranges.
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace engine {
+
+/**
+ * @brief Worker pool with stable worker indices
+ *
+ * Worker index 0 is the thread that calls wait(); background threads are
+ * 1..getWorkerCount()-1. A range is only ever run by one worker at a time,
+ * so callers can keep per-worker scratch data indexed by workerIndex.
+ *
+ * Usage:
+ *   TaskScheduler scheduler(4);
+ *   auto* task = scheduler.parallelFor(itemCount, 64,
+ *       [&](int start, int end, int worker) { ... });
+ *   scheduler.wait(task);
+ *
+ * @par Thread Safety
+ * parallelFor() may be called from any thread, but wait() must only be
+ * called from one thread at a time (it runs work as worker 0).
+ */
+class TaskScheduler {
+public:
+    /** @brief Range callback: items [start, end) on the given worker */
+    using RangeFunction = std::function<void(int start, int end, int workerIndex)>;
+
+    struct Task;
+
+    /**
+     * @param workerCount Total workers including the waiting thread
+     *                    (0 = one per hardware thread, 1 = no background threads)
+     */
+    explicit TaskScheduler(int workerCount = 0);
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    /** @brief Workers including the waiting thread (always >= 1) */
+    int getWorkerCount() const { return static_cast<int>(m_threads.size()) + 1; }
+
+    /**
+     * @brief Split [0, itemCount) into ranges of at least minRange items
+     *
+     * Every range is queued, even when there is only one, so callers that
+     * enqueue several single-item tasks get them run concurrently.
+     *
+     * @return Task to pass to wait(), or nullptr if the work ran inline -
+     *         on a single-worker scheduler, or when called from inside a
+     *         range of this scheduler (nested work keeps that worker index)
+     */
+    Task* parallelFor(int itemCount, int minRange, RangeFunction function);
+
+    /** @brief Help run queued ranges until the task is complete */
+    void wait(Task* task);
+
+    /** @brief Hardware threads, at least 1 */
+    static int getHardwareWorkerCount();
+
+    /**
+     * @brief Process-wide pool with the given worker count
+     *
+     * Callers asking for the same count share one pool, so several physics
+     * worlds don't each start a thread per core. The pool lives as long as
+     * any caller holds it. Users must not wait() on it from different
+     * threads at the same time.
+     *
+     * @param workerCount As for the constructor (0 = one per hardware thread)
+     */
+    static std::shared_ptr<TaskScheduler> acquireShared(int workerCount = 0);
+
+private:
+    struct Range {
+        Task* task = nullptr;
+        int start = 0;
+        int end = 0;
+    };
+
+    void workerLoop(int workerIndex);
+    void runRange(const Range& range, int workerIndex);
+    Task* acquireTask();
+
+    std::vector<std::thread> m_threads;
+    std::deque<Range> m_queue;
+    std::mutex m_mutex;
+    std::condition_variable m_workAvailable;
+    std::condition_variable m_taskDone;
+    bool m_stopping = false;
+
+    // Tasks are recycled - Box2D enqueues a handful every step
+    std::vector<std::unique_ptr<Task>> m_tasks;
+    std::vector<Task*> m_freeTasks;
+};
+
+} // namespace engine
@@ -0,0 +1,85 @@
+/**
+ * @file ActorView.h
+ * @brief Iterate the actors of a container that have a given set of components
+ */
+#pragma once
+
+#include "engine/core/ActorObjectExtended.h"
+#include <memory>
+#include <vector>
+
+namespace engine {
+
+/**
+ * @brief Actors that have every component in Ts
+ *
+ * Actors are matched on their component mask, so ones without the
+ * components are skipped with a single AND and never looked up.
+ * Inactive actors are included - check isActive() where it matters.
+ *
+ * @code
+ * for (auto* actor : scene->view<RigidBody2DComponent>()) { ... }
+ *
+ * scene->view<SpriteComponent, MovementComponent>().each(
+ *     [](ActorObjectExtended& actor, SpriteComponent& sprite, MovementComponent& movement) { ... });
+ * @endcode
+ *
+ * A view refers to the container's actor list; don't add or remove
+ * actors while iterating one.
+ */
+template<typename... Ts>
+class ActorView {
+public:
+    using ActorList = std::vector<std::unique_ptr<ActorObjectExtended>>;
+
+    class Iterator {
+    public:
+        Iterator(const ActorView* view, typename ActorList::const_iterator it)
+            : m_view(view), m_it(it) { skip(); }
+
+        ActorObjectExtended* operator*() const { return m_it->get(); }
+        Iterator& operator++() { ++m_it; skip(); return *this; }
+        bool operator==(const Iterator& other) const { return m_it == other.m_it; }
+        bool operator!=(const Iterator& other) const { return m_it != other.m_it; }
+
+    private:
+        void skip() {
+            while (m_it != m_view->m_actors.end() && !m_view->matches(m_it->get())) ++m_it;
+        }
+
+        const ActorView* m_view;
+        typename ActorList::const_iterator m_it;
+    };
+
+    explicit ActorView(const ActorList& actors)
+        : m_actors(actors)
+        , m_mask(componentMask<Ts...>())
+        , m_maskComplete(componentMaskComplete<Ts...>())
+    {
+    }
+
+    Iterator begin() const { return Iterator(this, m_actors.begin()); }
+    Iterator end() const { return Iterator(this, m_actors.end()); }
+
+    /** @brief Call fn(actor, Ts&...) for every matching actor */
+    template<typename Fn>
+    void each(Fn&& fn) const {
+        for (const auto& actor : m_actors) {
+            if (matches(actor.get())) {
+                fn(*actor, *actor->template getComponent<Ts>()...);
+            }
+        }
+    }
+
+private:
+    bool matches(const ActorObjectExtended* actor) const {
+        if (!actor || (actor->getComponentMask() & m_mask) != m_mask) return false;
+        return m_maskComplete || actor->template hasComponents<Ts...>();
+    }
+
+    const ActorList& m_actors;
+    ComponentMask m_mask;
+    bool m_maskComplete;
+};
+
+} // namespace engine
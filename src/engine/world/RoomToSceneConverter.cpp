@@ -31,6 +31,7 @@ std::unique_ptr<Scene> RoomToSceneConverter::convert(const SceneData& sceneData,
     // Convert background to SpriteActor
     if (!sceneData.background.empty()) {
         auto bgActor = std::make_unique<SpriteActor>("Background");
+        bgActor->setRole(ActorRole::Background);
         bgActor->setPosition(0, 0);
         
         // Load background texture
@@ -53,6 +54,7 @@ std::unique_ptr<Scene> RoomToSceneConverter::convert(const SceneData& sceneData,
     
     // Add player spawn marker (simple prop for now)
     auto spawnActor = std::make_unique<PropActor>("PlayerSpawn");
+    spawnActor->setRole(ActorRole::PlayerSpawn);
     spawnActor->setPosition(sceneData.playerSpawnX, sceneData.playerSpawnY);
     scene->addActor(std::move(spawnActor));
     
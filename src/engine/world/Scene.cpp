@@ -8,6 +8,9 @@
 #include "engine/data/DataLoader.h"
 #include "engine/core/ActorObjectExtended.h"
 #include "engine/components/SpriteComponent.h"
+#include "engine/components/RigidBody2DComponent.h"
+#include "engine/components/TriggerComponent.h"
+#include "engine/nodes/TileMapLayer.h"
 #include <SDL_image.h>
 #include <iostream>
 
@@ -15,6 +18,13 @@ namespace engine {
 
 // Constructors now in header
 
+Scene::~Scene() {
+    // The world may be shared and outlive this scene - take our geometry out
+    if (auto* world = getPhysicsWorld()) {
+        world->destroyBody(m_staticBody);
+    }
+}
+
 void Scene::update(float deltaTime) {
     if (m_isPaused) return;
     
@@ -23,29 +33,29 @@ void Scene::update(float deltaTime) {
         m_cameraActor->update(deltaTime);
     }
     
-    // Update all actors
-    for (auto& actor : m_actors) {
-        if (actor->isActive()) {
-            actor->update(deltaTime);
-        }
-    }
+    // Tick groups, ticking actors and CollisionComponent overlaps
+    updateActors(deltaTime);
 }
 
 void Scene::renderActors(SDL_Renderer* renderer) {
     if (!renderer) return;
     
-    // Render all actors
+    // Background first - removal reorders m_actors, so it isn't necessarily at the front
+    ActorObjectExtended* background = findActor(ActorRole::Background);
+    if (background && background->isActive()) {
+        // Fill entire viewport like legacy Room::render()
+        auto* spriteComp = background->getComponent<SpriteComponent>();
+        if (spriteComp && spriteComp->getTexture()) {
+            // Use nullptr for dest to fill entire render target (like legacy Room)
+            SDL_RenderCopy(renderer, spriteComp->getTexture(), nullptr, nullptr);
+        } else {
+            background->render(renderer);
+        }
+    }
+    
+    // Render all other actors
     for (const auto& actor : m_actors) {
-        if (actor && actor->isActive()) {
-            // Special handling for Background - fill entire viewport like legacy Room::render()
-            if (actor->getName() == "Background") {
-                auto* spriteComp = actor->getComponent<SpriteComponent>();
-                if (spriteComp && spriteComp->getTexture()) {
-                    // Use nullptr for dest to fill entire render target (like legacy Room)
-                    SDL_RenderCopy(renderer, spriteComp->getTexture(), nullptr, nullptr);
-                    continue;
-                }
-            }
+        if (actor && actor->isActive() && actor.get() != background) {
             actor->render(renderer);
         }
     }
@@ -81,6 +91,7 @@ std::unique_ptr<Scene> Scene::createFromData(const SceneData& data) {
     // Use data.id as scene name for lookups (e.g. "tavern")
     // data.name is display name (e.g. "The Rusty Anchor")
     auto scene = std::make_unique<Scene>(data.id);
+    scene->enableSceneArena();
     
     // Set grid position if available
     if (data.gridPosition) {
@@ -100,7 +111,8 @@ std::unique_ptr<Scene> Scene::createFromData(const SceneData& data) {
     }
     
     // Create actor for background FIRST so it renders behind everything
-    auto bgActor = std::make_unique<ActorObjectExtended>("Background");
+    auto* bgActor = scene->createActor("Background");
+    bgActor->setRole(ActorRole::Background);
     bgActor->setPosition(0.0f, 0.0f);
     std::cout << "[DEBUG] Creating Background actor for scene: " << data.name << std::endl;
     // Add sprite component for background if we have a path
@@ -109,7 +121,6 @@ std::unique_ptr<Scene> Scene::createFromData(const SceneData& data) {
         std::cout << "[DEBUG] Added SpriteComponent to Background actor" << std::endl;
         // Note: Texture will be loaded later when renderer is available
     }
-    scene->addActor(std::move(bgActor));
     std::cout << "[DEBUG] Added Background actor to scene" << std::endl;
     
     // Create actors for hotspots (skip NPCs - they're created separately)
@@ -117,16 +128,15 @@ std::unique_ptr<Scene> Scene::createFromData(const SceneData& data) {
         // Skip NPC hotspots - NPCActors are created from NPC data
         // Note: type in JSON is lowercase "npc"
         if (hs.type != "npc" && hs.type != "NPC") {
-            auto actor = std::make_unique<ActorObjectExtended>(hs.name);
+            auto* actor = scene->createActor(hs.name);
             actor->setPosition(static_cast<float>(hs.x), static_cast<float>(hs.y));
-            scene->addActor(std::move(actor));
         }
     }
     
     // Create actor for player spawn
-    auto spawnActor = std::make_unique<ActorObjectExtended>("PlayerSpawn");
+    auto* spawnActor = scene->createActor("PlayerSpawn");
+    spawnActor->setRole(ActorRole::PlayerSpawn);
     spawnActor->setPosition(static_cast<float>(data.playerSpawnX), static_cast<float>(data.playerSpawnY));
-    scene->addActor(std::move(spawnActor));
     
     // Create NPCActors from NPC data
     const auto& npcs = DataLoader::instance().getNPCs();
@@ -135,7 +145,7 @@ std::unique_ptr<Scene> Scene::createFromData(const SceneData& data) {
         std::cout << "[DEBUG] NPC " << npcData.name << " is in room: " << npcData.room << std::endl;
         if (npcData.room == data.id) {  // Match against data.id (e.g. "tavern")
             std::cout << "[DEBUG] Creating NPCActor: " << npcData.name << std::endl;
-            auto npcActor = std::make_unique<engine::NPCActor>(npcData.name, npcData.sprite);
+            auto* npcActor = scene->createActor<engine::NPCActor>(npcData.name, npcData.sprite);
             npcActor->setPosition(static_cast<float>(npcData.x), static_cast<float>(npcData.y));
             
             // Set speed
@@ -148,8 +158,6 @@ std::unique_ptr<Scene> Scene::createFromData(const SceneData& data) {
             
             // Set interaction text
             npcActor->setInteractionText("Prata med " + npcData.name);
-            
-            scene->addActor(std::move(npcActor));
         }
     }
     
@@ -244,14 +252,11 @@ void Scene::updateNPCs(float deltaTime) {
 }
 
 void Scene::getPlayerSpawn(float& x, float& y) const {
-    // Find PlayerSpawn actor
-    for (const auto& actor : getActors()) {
-        if (actor && actor->getName() == "PlayerSpawn") {
-            auto pos = actor->getPosition();
-            x = pos.x;
-            y = pos.y;
-            return;
-        }
+    if (auto* spawnActor = findActor(ActorRole::PlayerSpawn)) {
+        auto pos = spawnActor->getPosition();
+        x = pos.x;
+        y = pos.y;
+        return;
     }
     // Default fallback
     x = 320.0f;
@@ -259,17 +264,96 @@ void Scene::getPlayerSpawn(float& x, float& y) const {
 }
 
 void Scene::setPlayerSpawn(float x, float y) {
-    // Find and update PlayerSpawn actor
-    for (const auto& actor : getActors()) {
-        if (actor && actor->getName() == "PlayerSpawn") {
-            actor->setPosition(x, y);
-            return;
-        }
+    if (auto* spawnActor = findActor(ActorRole::PlayerSpawn)) {
+        spawnActor->setPosition(x, y);
+        return;
     }
     // Create if not found
-    auto spawnActor = std::make_unique<ActorObjectExtended>("PlayerSpawn");
+    auto* spawnActor = createActor("PlayerSpawn");
+    spawnActor->setRole(ActorRole::PlayerSpawn);
     spawnActor->setPosition(x, y);
-    addActor(std::move(spawnActor));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// STATIC PHYSICS
+// ═══════════════════════════════════════════════════════════════════════════
+
+b2BodyId Scene::getOrCreateStaticBody() {
+    if (B2_IS_NON_NULL(m_staticBody)) return m_staticBody;
+    
+    auto* world = getPhysicsWorld();
+    if (!world || !world->isInitialized()) return b2_nullBodyId;
+    
+    physics::BodyDef2D def;
+    def.type = physics::BodyType2D::Static;
+    m_staticBody = world->createBody(def);
+    
+    // Built while another scene is current (preloading) - stay out of its way
+    world->setBodyEnabled(m_staticBody, m_physicsActive);
+    return m_staticBody;
+}
+
+b2ShapeId Scene::addStaticBox(float x, float y, float width, float height) {
+    b2BodyId body = getOrCreateStaticBody();
+    if (B2_IS_NULL(body)) return b2_nullShapeId;
+    
+    physics::ShapeDef2D def;
+    def.type = physics::ShapeType2D::Box;
+    def.size = {width, height};
+    def.offset = {x + width / 2.0f, y + height / 2.0f};
+    
+    b2ShapeId shapeId = getPhysicsWorld()->addShape(body, def);
+    if (B2_IS_NON_NULL(shapeId)) m_staticShapeCount++;
+    return shapeId;
+}
+
+b2ShapeId Scene::addStaticSensor(float x, float y, float width, float height, TriggerComponent* trigger) {
+    b2BodyId body = getOrCreateStaticBody();
+    if (B2_IS_NULL(body)) return b2_nullShapeId;
+    
+    physics::ShapeDef2D def;
+    def.type = physics::ShapeType2D::Box;
+    def.size = {width, height};
+    def.offset = {x + width / 2.0f, y + height / 2.0f};
+    def.isSensor = true;
+    def.userData = trigger ? trigger->getOwner() : nullptr;
+    
+    b2ShapeId shapeId = getPhysicsWorld()->addShape(body, def);
+    if (B2_IS_NULL(shapeId)) return shapeId;
+    
+    m_staticShapeCount++;
+    if (trigger) {
+        trigger->attachSensor(getPhysicsWorld(), shapeId);
+    }
+    return shapeId;
+}
+
+void Scene::setPhysicsActive(bool active) {
+    m_physicsActive = active;
+    
+    auto* world = getPhysicsWorld();
+    if (!world) return;
+    
+    world->setBodyEnabled(m_staticBody, active);
+    
+    view<RigidBody2DComponent>().each([&](ActorObjectExtended&, RigidBody2DComponent& rigidBody) {
+        if (rigidBody.getWorld() == world) {
+            world->setBodyEnabled(rigidBody.getBodyId(), active);
+        }
+    });
+    
+    for (const auto& actor : m_actors) {
+        if (auto* tileMap = dynamic_cast<TileMapLayer*>(actor.get())) {
+            tileMap->setCollisionEnabled(active);
+        }
+    }
+    
+    if (!active) {
+        // Disabled sensors may not report their visitors leaving
+        view<TriggerComponent>().each([](ActorObjectExtended&, TriggerComponent& trigger) {
+            trigger.clearOverlaps();
+        });
+    }
 }
 
 } // namespace engine
@@ -22,6 +22,8 @@ struct SceneData;
 
 namespace engine {
 
+class TriggerComponent;
+
 /**
  * @brief Scene type for categorization and filtering
  */
@@ -85,10 +87,13 @@ inline const char* getSceneTypeIcon(SceneType type) {
  */
 class Scene : public WorldContainer {
 public:
-    Scene() : WorldContainer("Scene") {}
-    explicit Scene(const std::string& name) : WorldContainer(name) {}
-    Scene(const std::string& name, SceneType type) : WorldContainer(name), m_sceneType(type) {}
-    virtual ~Scene() = default;
+    // Every scene batches its CollisionComponent overlaps (see CollisionSystem)
+    Scene() : WorldContainer("Scene") { enableCollisionSystem(); }
+    explicit Scene(const std::string& name) : WorldContainer(name) { enableCollisionSystem(); }
+    Scene(const std::string& name, SceneType type) : WorldContainer(name), m_sceneType(type) {
+        enableCollisionSystem();
+    }
+    virtual ~Scene();
     
     /** @brief Create Scene from SceneData */
     static std::unique_ptr<Scene> createFromData(const SceneData& data);
@@ -164,6 +169,41 @@ public:
     // addActor/getActors/findActor inherited from WorldContainer
     // getGridPosition/setGridPosition inherited from WorldContainer
     
+    // ═══════════════════════════════════════════════════════════════════
+    // STATIC PHYSICS
+    // ═══════════════════════════════════════════════════════════════════
+    
+    /**
+     * @brief Add a box to the scene's static geometry (rect in pixels, top-left)
+     *
+     * All static geometry shares one Box2D body, created on first use in
+     * getPhysicsWorld(). Built once per scene; scene changes only toggle it
+     * with setPhysicsActive().
+     */
+    b2ShapeId addStaticBox(float x, float y, float width, float height);
+    
+    /**
+     * @brief Add a sensor box to the static geometry and route its events to trigger
+     * @param trigger Receives enter/exit events; its actor should be in this scene
+     */
+    b2ShapeId addStaticSensor(float x, float y, float width, float height, TriggerComponent* trigger);
+    
+    /** @brief True once static geometry has been built */
+    bool hasStaticPhysics() const { return B2_IS_NON_NULL(m_staticBody); }
+    
+    /** @brief Number of static shapes (boxes and sensors) */
+    int getStaticShapeCount() const { return m_staticShapeCount; }
+    
+    /**
+     * @brief Enable or disable every body this scene has in its physics world
+     *
+     * Covers the static geometry body, RigidBody2DComponents on scene actors
+     * and tile map collision. Called by SceneManager::changeScene, so scenes
+     * sharing one world don't collide with or trigger each other.
+     */
+    void setPhysicsActive(bool active);
+    bool isPhysicsActive() const { return m_physicsActive; }
+    
     // ═══════════════════════════════════════════════════════════════════
     // CAMERA CONFIG (Scene-specific)
     // ═══════════════════════════════════════════════════════════════════
@@ -172,6 +212,8 @@ public:
     void setCameraConfig(const CameraConfig& config) { m_cameraConfig = config; }
     
 private:
+    b2BodyId getOrCreateStaticBody();
+    
     std::string m_id;  // Scene ID for lookup (separate from display name)
     bool m_isPaused = false;
     SceneType m_sceneType = SceneType::Interior;  // Default type
@@ -188,6 +230,11 @@ private:
     WalkArea m_legacyWalkArea;
     std::vector<std::unique_ptr<engine::actors::NPC>> m_npcs;
     std::string m_backgroundPath;
+    
+    // Static geometry, one body with a shape per collision box/sensor
+    b2BodyId m_staticBody = b2_nullBodyId;
+    int m_staticShapeCount = 0;
+    bool m_physicsActive = true;
 };
 
 } // namespace engine
@@ -11,8 +11,11 @@
 #pragma once
 
 #include "engine/core/ActorObjectExtended.h"
+#include "ActorView.h"
 #include "engine/physics/box2d/PhysicsWorld2D.h"
+#include "engine/physics/CollisionSystem.h"
 #include "GridTypes.h"
+#include <algorithm>
 #include <string>
 #include <memory>
 #include <vector>
@@ -66,9 +69,16 @@ public:
     // ACTORS
     // ═══════════════════════════════════════════════════════════════════
     
+    /**
+     * @brief Add an actor - deferred to the next sync point while updating
+     * (see spawnActor())
+     */
     void addActor(std::unique_ptr<ActorObjectExtended> actor) {
-        if (actor) {
-            m_actors.push_back(std::move(actor));
+        if (!actor) return;
+        if (m_updating) {
+            m_pendingSpawns.push_back(std::move(actor));
+        } else {
+            insertActor(std::move(actor));
         }
     }
     
@@ -76,34 +86,199 @@ public:
         return m_actors;
     }
     
-    ActorObjectExtended* findActor(const std::string& name) const {
-        for (auto& actor : m_actors) {
-            if (actor->getName() == name) {
-                return actor.get();
-            }
+    /**
+     * @brief Construct an actor and add it
+     *
+     * With component pools enabled, components the actor adds (in its
+     * constructor or later) are placed in this container's pools. Actor
+     * types without their own update() are left out of the actor tick list.
+     */
+    template<typename T = ActorObjectExtended, typename... Args>
+    T* createActor(Args&&... args) {
+        ComponentStorage::Scope scope(m_componentStorage.get());
+        auto actor = std::make_unique<T>(std::forward<Args>(args)...);
+        if constexpr (!ActorObjectExtended::overridesUpdate<T>()) {
+            actor->setCanEverTick(false);
         }
-        return nullptr;
+        T* ptr = actor.get();
+        addActor(std::move(actor));
+        return ptr;
+    }
+    
+    /** @brief Actor with this name (the first one added if several share it) */
+    ActorObjectExtended* findActor(Name name) const {
+        return m_actorIndex.find(name);
+    }
+    
+    /** @brief Actor with this role, e.g. ActorRole::Background */
+    ActorObjectExtended* findActor(ActorRole role) const {
+        return m_actorIndex.find(role);
+    }
+    
+    /**
+     * @brief Actors that have all components in Ts
+     * e.g. view<SpriteComponent, MovementComponent>().each(...), see ActorView
+     */
+    template<typename... Ts>
+    ActorView<Ts...> view() const {
+        return ActorView<Ts...>(m_actors);
     }
     
+    /**
+     * @brief Remove and destroy an actor - deferred to the next sync point
+     * while updating (see destroyActor())
+     *
+     * The last actor takes the removed one's place, so removal doesn't
+     * keep the order of getActors().
+     */
     bool removeActor(ActorObjectExtended* actor) {
-        for (auto it = m_actors.begin(); it != m_actors.end(); ++it) {
-            if (it->get() == actor) {
-                m_actors.erase(it);
-                return true;
+        if (m_updating) {
+            return destroyActor(actor);
+        }
+        return eraseActor(actor) || erasePendingSpawn(actor);
+    }
+    
+    // ═══════════════════════════════════════════════════════════════════
+    // DEFERRED SPAWN/DESTROY
+    // ═══════════════════════════════════════════════════════════════════
+    
+    /**
+     * @brief Construct an actor now, add it at the next sync point
+     *
+     * Safe from anywhere - inside update(), triggers, cutscenes, AI -
+     * because getActors() doesn't change until flushActorCommands().
+     * The actor is constructed like createActor() (pools, tick settings).
+     */
+    template<typename T = ActorObjectExtended, typename... Args>
+    T* spawnActor(Args&&... args) {
+        ComponentStorage::Scope scope(m_componentStorage.get());
+        auto actor = std::make_unique<T>(std::forward<Args>(args)...);
+        if constexpr (!ActorObjectExtended::overridesUpdate<T>()) {
+            actor->setCanEverTick(false);
+        }
+        T* ptr = actor.get();
+        m_pendingSpawns.push_back(std::move(actor));
+        return ptr;
+    }
+    
+    /**
+     * @brief Destroy an actor at the next sync point
+     *
+     * The actor is deactivated right away, so it doesn't tick or render
+     * for the rest of the frame. Returns false if it isn't in this
+     * container (or pending spawn).
+     */
+    bool destroyActor(ActorObjectExtended* actor) {
+        if (!actor || (!containsActor(actor) && !isPendingSpawn(actor))) return false;
+        if (std::find(m_pendingDestroys.begin(), m_pendingDestroys.end(), actor) == m_pendingDestroys.end()) {
+            actor->setActive(false);
+            m_pendingDestroys.push_back(actor);
+        }
+        return true;
+    }
+    
+    /**
+     * @brief Apply recorded spawns, then destroys (the sync point)
+     *
+     * updateActors() calls this once at the end of the frame; call it
+     * yourself outside updates to apply commands immediately. Commands
+     * recorded while flushing (e.g. by a destroyed actor's destructor)
+     * run in the same flush.
+     */
+    void flushActorCommands() {
+        while (!m_pendingSpawns.empty() || !m_pendingDestroys.empty()) {
+            auto spawns = std::move(m_pendingSpawns);
+            m_pendingSpawns.clear();
+            for (auto& actor : spawns) {
+                insertActor(std::move(actor));
+            }
+            
+            // One at a time - a destructor may remove other pending actors
+            while (!m_pendingDestroys.empty()) {
+                ActorObjectExtended* actor = m_pendingDestroys.back();
+                m_pendingDestroys.pop_back();
+                eraseActor(actor);
             }
         }
-        return false;
+    }
+    
+    /** @brief Commands waiting for the next sync point */
+    size_t getPendingSpawnCount() const { return m_pendingSpawns.size(); }
+    size_t getPendingDestroyCount() const { return m_pendingDestroys.size(); }
+    
+    /** @brief Tick lists of the actors in this container */
+    const TickManager& getTickManager() const { return m_tickManager; }
+    
+    // ═══════════════════════════════════════════════════════════════════
+    // COMPONENT POOLS
+    // ═══════════════════════════════════════════════════════════════════
+    
+    /** @brief Store components of actors made by createActor() in per-type pools */
+    void enableComponentPools() {
+        if (!m_componentStorage) {
+            m_componentStorage = std::make_shared<ComponentStorage>();
+        }
+    }
+    
+    /**
+     * @brief Allocate actors made by createActor() and their pooled
+     * components from one scene arena (implies component pools)
+     *
+     * Memory is not reused while the scene lives; it goes back to the heap
+     * in one go once the scene and all its actors are gone. Must be called
+     * before the first createActor(); ignored if pools already exist.
+     */
+    void enableSceneArena(size_t initialBlockSize = MemoryArena::DEFAULT_BLOCK_SIZE) {
+        if (m_componentStorage) return;
+        MemoryArena* arena = MemoryArena::create(initialBlockSize);
+        m_componentStorage = std::make_shared<ComponentStorage>(arena);
+        arena->release();  // The storage holds it now
+    }
+    
+    /** @brief Scene arena (nullptr unless enableSceneArena() was called) */
+    MemoryArena* getSceneArena() const { return m_componentStorage ? m_componentStorage->getArena() : nullptr; }
+    
+    bool hasComponentPools() const { return m_componentStorage != nullptr; }
+    ComponentStorage* getComponentStorage() const { return m_componentStorage.get(); }
+    
+    /** @brief Pool of T components (nullptr without pools or before the first T) */
+    template<typename T>
+    ComponentPool<T>* getComponentPool() const {
+        return m_componentStorage ? m_componentStorage->getPool<T>() : nullptr;
+    }
+    
+    /** @brief Call fn(T&) for every pooled T in memory order - heap components are not visited */
+    template<typename T, typename Fn>
+    void forEachComponent(Fn&& fn) const {
+        if (auto* pool = getComponentPool<T>()) {
+            pool->forEach(std::forward<Fn>(fn));
+        }
     }
     
     // ═══════════════════════════════════════════════════════════════════
     // PHYSICS (Box2D)
     // ═══════════════════════════════════════════════════════════════════
     
-    /** @brief Enable physics for this container */
-    void enablePhysics(glm::vec2 gravity = {0.0f, 980.0f}) {
-        if (!m_physicsWorld) {
+    /**
+     * @brief Enable physics for this container
+     * @param workerCount Solver threads (0 = hardware threads, 1 = single-threaded)
+     */
+    void enablePhysics(glm::vec2 gravity = {0.0f, 980.0f}, int workerCount = 0) {
+        if (!m_physicsWorld && !m_sharedPhysicsWorld) {
             m_physicsWorld = std::make_unique<physics::PhysicsWorld2D>();
-            m_physicsWorld->initialize(gravity);
+            m_physicsWorld->initialize(gravity, workerCount);
+        }
+    }
+    
+    /**
+     * @brief Use a world owned elsewhere (e.g. SceneManager) instead of an own one
+     *
+     * The shared world is not stepped by this container; its owner steps it
+     * once for all containers. Ignored if this container already owns a world.
+     */
+    void usePhysicsWorld(physics::PhysicsWorld2D* world) {
+        if (!m_physicsWorld) {
+            m_sharedPhysicsWorld = world;
         }
     }
     
@@ -113,44 +288,105 @@ public:
             m_physicsWorld->shutdown();
             m_physicsWorld.reset();
         }
+        m_sharedPhysicsWorld = nullptr;
     }
     
     /** @brief Check if physics is enabled */
-    bool hasPhysics() const { return m_physicsWorld != nullptr; }
+    bool hasPhysics() const { return getPhysicsWorld() != nullptr; }
     
-    /** @brief Get physics world (may be null) */
-    physics::PhysicsWorld2D* getPhysicsWorld() const { return m_physicsWorld.get(); }
+    /** @brief True if the physics world is shared with other containers */
+    bool hasSharedPhysics() const { return !m_physicsWorld && m_sharedPhysicsWorld; }
+    
+    /** @brief Get physics world, own or shared (may be null) */
+    physics::PhysicsWorld2D* getPhysicsWorld() const {
+        return m_physicsWorld ? m_physicsWorld.get() : m_sharedPhysicsWorld;
+    }
     
     /** @brief Set gravity (pixels/s²) */
     void setGravity(glm::vec2 gravity) {
-        if (m_physicsWorld) {
-            m_physicsWorld->setGravity(gravity);
+        if (auto* world = getPhysicsWorld()) {
+            world->setGravity(gravity);
         }
     }
     
     /** @brief Enable/disable physics debug rendering */
     void setPhysicsDebugDraw(bool enabled) {
-        if (m_physicsWorld) {
-            m_physicsWorld->setDebugDraw(enabled);
+        if (auto* world = getPhysicsWorld()) {
+            world->setDebugDraw(enabled);
         }
     }
     
+    // ═══════════════════════════════════════════════════════════════════
+    // COLLISION (CollisionComponent)
+    // ═══════════════════════════════════════════════════════════════════
+    
+    /** @brief Resolve CollisionComponent overlaps in one batch per frame */
+    void enableCollisionSystem(int cellSize = 64) {
+        if (!m_collisionSystem) {
+            m_collisionSystem = std::make_unique<CollisionSystem>(cellSize);
+        }
+    }
+    
+    void disableCollisionSystem() { m_collisionSystem.reset(); }
+    
+    /** @brief Get collision system (may be null) */
+    CollisionSystem* getCollisionSystem() const { return m_collisionSystem.get(); }
+    
 protected:
-    /** @brief Step physics simulation (call in update) */
+    /** @brief Step physics simulation (call in update), shared worlds are stepped by their owner */
     void stepPhysics(float deltaTime) {
         if (m_physicsWorld) {
             m_physicsWorld->step(deltaTime);
         }
     }
     
-    /** @brief Update all actors in this container (call in update) */
+    /** @brief Dispatch CollisionComponent callbacks (call after actors moved) */
+    void resolveCollisions() {
+        if (m_collisionSystem) {
+            m_collisionSystem->update(m_actors);
+        }
+    }
+    
+    /**
+     * @brief Refresh cached global transforms of moved actors, parents first
+     *
+     * One breadth-first pass from the root actors; clean actors are only
+     * visited. Getters stay correct between passes by recomputing lazily.
+     */
+    void updateTransforms() {
+        m_transformQueue.clear();
+        for (const auto& actor : m_actors) {
+            if (!actor->getParent()) m_transformQueue.push_back(actor.get());
+        }
+        for (size_t i = 0; i < m_transformQueue.size(); i++) {
+            ActorObject* actor = m_transformQueue[i];
+            if (actor->isTransformDirty()) actor->getGlobalTransform();
+            const auto& children = actor->getChildren();
+            m_transformQueue.insert(m_transformQueue.end(), children.begin(), children.end());
+        }
+    }
+    
+    /**
+     * @brief Update all actors in this container (call in update)
+     *
+     * Walks the tick lists rather than every actor and component:
+     * PrePhysics components, physics step, ticking actors, PostPhysics
+     * components, global transforms, CollisionComponent overlaps,
+     * PostUpdate components.
+     */
     void updateActors(float deltaTime) {
+        m_updating = true;
+        m_tickManager.tick(TickGroup::PrePhysics, deltaTime);
         stepPhysics(deltaTime);
-        for (auto& actor : m_actors) {
-            if (actor && actor->isActive()) {
-                actor->update(deltaTime);
-            }
-        }
+        m_tickManager.tickActors(deltaTime);
+        m_tickManager.tick(TickGroup::PostPhysics, deltaTime);
+        updateTransforms();
+        resolveCollisions();
+        m_tickManager.tick(TickGroup::PostUpdate, deltaTime);
+        m_updating = false;
+        
+        // Sync point - spawns and destroys recorded this frame
+        flushActorCommands();
     }
     
     /** @brief Render all actors in this container (call in render) */
@@ -165,15 +401,79 @@ protected:
     
     /** @brief Render physics debug (call in render) */
     void renderPhysicsDebug(SDL_Renderer* renderer, glm::vec2 cameraOffset = {0, 0}, float zoom = 1.0f) {
-        if (m_physicsWorld && m_physicsWorld->isDebugDrawEnabled()) {
-            m_physicsWorld->debugDraw(renderer, cameraOffset, zoom);
+        auto* world = getPhysicsWorld();
+        if (world && world->isDebugDrawEnabled()) {
+            world->debugDraw(renderer, cameraOffset, zoom);
         }
     }
     
     std::string m_name;
+    // Declared before m_actors so it's destroyed after them - physics
+    // components unregister from the world in their destructors
+    std::unique_ptr<physics::PhysicsWorld2D> m_physicsWorld;  // Optional physics
+    physics::PhysicsWorld2D* m_sharedPhysicsWorld = nullptr;  // Not owned, see usePhysicsWorld()
+    std::shared_ptr<ComponentStorage> m_componentStorage;     // Optional, see enableComponentPools()
+    TickManager m_tickManager;                                // Must outlive m_actors
+    ActorIndex m_actorIndex;                                  // Must outlive m_actors
     std::vector<std::unique_ptr<ActorObjectExtended>> m_actors;
     GridPosition m_gridPosition = {0, 0, 640, 400};  // Default size
-    std::unique_ptr<physics::PhysicsWorld2D> m_physicsWorld;  // Optional physics
+    std::unique_ptr<CollisionSystem> m_collisionSystem;       // Optional CollisionComponent batching
+    std::vector<ActorObject*> m_transformQueue;               // Reused by updateTransforms()
+    
+    // Deferred commands, applied by flushActorCommands()
+    std::vector<std::unique_ptr<ActorObjectExtended>> m_pendingSpawns;
+    std::vector<ActorObjectExtended*> m_pendingDestroys;
+    bool m_updating = false;  // Inside updateActors() - add/remove are deferred
+    
+private:
+    bool containsActor(const ActorObjectExtended* actor) const {
+        size_t index = actor->m_containerIndex;
+        return index < m_actors.size() && m_actors[index].get() == actor;
+    }
+    
+    bool isPendingSpawn(const ActorObjectExtended* actor) const {
+        for (const auto& pending : m_pendingSpawns) {
+            if (pending.get() == actor) return true;
+        }
+        return false;
+    }
+    
+    void insertActor(std::unique_ptr<ActorObjectExtended> actor) {
+        m_tickManager.addActor(actor.get());
+        m_actorIndex.add(actor.get());
+        actor->m_containerIndex = m_actors.size();
+        m_actors.push_back(std::move(actor));
+    }
+    
+    /** @brief Swap-and-pop removal, destroys the actor */
+    bool eraseActor(ActorObjectExtended* actor) {
+        if (!actor || !containsActor(actor)) return false;
+        
+        m_tickManager.removeActor(actor);
+        m_actorIndex.remove(actor);
+        m_pendingDestroys.erase(std::remove(m_pendingDestroys.begin(), m_pendingDestroys.end(), actor),
+                                m_pendingDestroys.end());
+        
+        size_t index = actor->m_containerIndex;
+        std::unique_ptr<ActorObjectExtended> removed = std::move(m_actors[index]);
+        if (index + 1 != m_actors.size()) {
+            m_actors[index] = std::move(m_actors.back());
+            m_actors[index]->m_containerIndex = index;
+        }
+        m_actors.pop_back();
+        removed->m_containerIndex = SIZE_MAX;
+        return true;  // removed is destroyed here, after the list is consistent
+    }
+    
+    bool erasePendingSpawn(ActorObjectExtended* actor) {
+        for (auto it = m_pendingSpawns.begin(); it != m_pendingSpawns.end(); ++it) {
+            if (it->get() == actor) {
+                m_pendingSpawns.erase(it);
+                return true;
+            }
+        }
+        return false;
+    }
 };
 
 } // namespace engine
@@ -19,6 +19,7 @@
 #include "engine/components/Collider2DComponent.h"
 #include "engine/components/CharacterController2D.h"
 #include "engine/components/TriggerComponent.h"
+#include "engine/nodes/TileMapLayer.h"
 #include "engine/physics/box2d/PhysicsWorld2D.h"
 #include "engine/world/Scene.h"
 #include "engine/Hotspot.h"
@@ -105,71 +106,26 @@ void PlayState::onRoomChange(const std::string& roomId) {
         auto& settings = engine::GameSettings::instance();
         
         if (settings.isPlatformerMode() && !scene->hasPhysics()) {
-            scene->enablePhysics({0.0f, settings.getGravity()});
+            // One world for every scene. Static geometry is built the first
+            // time a scene is entered; later visits only re-enable it
+            // (SceneManager::changeScene toggles Scene::setPhysicsActive)
+            auto* world = SceneManager::instance().enablePhysics({0.0f, settings.getGravity()},
+                                                                 settings.getPhysicsWorkerCount());
+            scene->usePhysicsWorld(world);
             scene->setPhysicsDebugDraw(settings.isPhysicsDebugEnabled());
             std::cout << "[Physics] Enabled for scene: " << roomId << std::endl;
             
-            // Setup contact callbacks for triggers
-            scene->getPhysicsWorld()->onContactBegin = [](const engine::physics::ContactInfo& info) {
-                if (!info.isSensorContact) return;
-                
-                // Try to find TriggerComponent on sensor actor
-                auto* actorA = dynamic_cast<engine::ActorObjectExtended*>(info.actorA);
-                auto* actorB = dynamic_cast<engine::ActorObjectExtended*>(info.actorB);
-                
-                if (actorA) {
-                    auto* trigger = actorA->getComponent<engine::TriggerComponent>();
-                    if (trigger) {
-                        trigger->onTriggerEnter(actorB);
-                    }
-                }
-                if (actorB) {
-                    auto* trigger = actorB->getComponent<engine::TriggerComponent>();
-                    if (trigger) {
-                        trigger->onTriggerEnter(actorA);
-                    }
-                }
-            };
-            
-            scene->getPhysicsWorld()->onContactEnd = [](const engine::physics::ContactInfo& info) {
-                if (!info.isSensorContact) return;
-                
-                auto* actorA = dynamic_cast<engine::ActorObjectExtended*>(info.actorA);
-                auto* actorB = dynamic_cast<engine::ActorObjectExtended*>(info.actorB);
-                
-                if (actorA) {
-                    auto* trigger = actorA->getComponent<engine::TriggerComponent>();
-                    if (trigger) {
-                        trigger->onTriggerExit(actorB);
-                    }
-                }
-                if (actorB) {
-                    auto* trigger = actorB->getComponent<engine::TriggerComponent>();
-                    if (trigger) {
-                        trigger->onTriggerExit(actorA);
-                    }
-                }
-            };
+            // Trigger events go straight from PhysicsWorld2D::step to the
+            // TriggerComponent registered on each sensor shape
             
-            // Load collision boxes from scene data
+            // Load collision boxes from scene data - all on the scene's static body
             const SceneData* sceneData = DataLoader::instance().getSceneById(roomId);
             if (sceneData && !sceneData->collisionBoxes.empty()) {
                 for (const auto& box : sceneData->collisionBoxes) {
-                    auto collider = std::make_unique<engine::ActorObjectExtended>("Collider_" + box.id);
-                    // Position at center of box
-                    collider->setPosition(box.x + box.width / 2.0f, box.y + box.height / 2.0f);
-                    
-                    auto* rb = collider->addComponent<engine::RigidBody2DComponent>();
-                    rb->setBodyType(engine::RigidBody2DComponent::BodyType::Static);
-                    rb->initializeBody(scene->getPhysicsWorld());
-                    
-                    auto* col = collider->addComponent<engine::Collider2DComponent>();
-                    col->setBoxShape(box.width, box.height);
-                    col->initializeShape();
-                    
-                    scene->addActor(std::move(collider));
-                    std::cout << "[Physics] Created collision box: " << box.id << " (" << box.type << ")" << std::endl;
+                    scene->addStaticBox(box.x, box.y, box.width, box.height);
                 }
+                std::cout << "[Physics] Created " << sceneData->collisionBoxes.size()
+                          << " collision boxes on one static body" << std::endl;
             }
             
             // Load hotspots with physics (triggers/gates)
@@ -179,17 +135,11 @@ void PlayState::onRoomChange(const std::string& roomId) {
                         auto trigger = std::make_unique<engine::ActorObjectExtended>("Trigger_" + hs.id);
                         trigger->setPosition(hs.x + hs.w / 2.0f, hs.y + hs.h / 2.0f);
                         
-                        auto* rb = trigger->addComponent<engine::RigidBody2DComponent>();
-                        rb->setBodyType(engine::RigidBody2DComponent::BodyType::Static);
-                        rb->initializeBody(scene->getPhysicsWorld());
-                        
-                        auto* col = trigger->addComponent<engine::Collider2DComponent>();
-                        col->setBoxShape(static_cast<float>(hs.w), static_cast<float>(hs.h));
-                        col->setTrigger(true);
-                        col->initializeShape();
-                        
-                        // Add TriggerComponent with scene transition callback
+                        // Add TriggerComponent with scene transition callback; its
+                        // sensor is a shape on the scene's static body
                         auto* triggerComp = trigger->addComponent<engine::TriggerComponent>();
+                        scene->addStaticSensor(static_cast<float>(hs.x), static_cast<float>(hs.y),
+                                               static_cast<float>(hs.w), static_cast<float>(hs.h), triggerComp);
                         
                         // Capture target scene for the callback
                         std::string targetScene = hs.targetScene;
@@ -215,20 +165,19 @@ void PlayState::onRoomChange(const std::string& roomId) {
                 }
             }
             
-            if (!sceneData || sceneData->collisionBoxes.empty()) {
+            // Tile map collision - solid tiles merged into a few static boxes
+            bool hasTileCollision = false;
+            for (const auto& actor : scene->getActors()) {
+                auto* tileMap = dynamic_cast<engine::TileMapLayer*>(actor.get());
+                if (tileMap && tileMap->getCollisionRectCount() > 0) {
+                    tileMap->buildCollision(world);
+                    hasTileCollision = true;
+                }
+            }
+            
+            if ((!sceneData || sceneData->collisionBoxes.empty()) && !hasTileCollision) {
                 // Fallback: Create ground collider at bottom of walk area
-                auto ground = std::make_unique<engine::ActorObjectExtended>("Ground");
-                ground->setPosition(320, static_cast<float>(wa.maxY + 10));
-                
-                auto* groundRb = ground->addComponent<engine::RigidBody2DComponent>();
-                groundRb->setBodyType(engine::RigidBody2DComponent::BodyType::Static);
-                groundRb->initializeBody(scene->getPhysicsWorld());
-                
-                auto* groundCol = ground->addComponent<engine::Collider2DComponent>();
-                groundCol->setBoxShape(640, 20);
-                groundCol->initializeShape();
-                
-                scene->addActor(std::move(ground));
+                scene->addStaticBox(0.0f, static_cast<float>(wa.maxY), 640.0f, 20.0f);
                 std::cout << "[Physics] Ground collider created (fallback)" << std::endl;
             }
         }
@@ -237,16 +186,19 @@ void PlayState::onRoomChange(const std::string& roomId) {
         // PLAYER PHYSICS - Initialize player physics in current scene's world
         // ═══════════════════════════════════════════════════════════════
         if (settings.isPlatformerMode() && scene->hasPhysics()) {
+            // The shared world outlives this room - pick up settings changes
+            scene->setGravity({0.0f, settings.getGravity()});
+            
             // Get or create RigidBody2D for player
             auto* rb = m_player->getComponent<engine::RigidBody2DComponent>();
             if (!rb) {
                 rb = m_player->addComponent<engine::RigidBody2DComponent>();
             }
             
-            // Re-initialize body in new physics world (for scene transitions)
-            rb->setBodyType(engine::RigidBody2DComponent::BodyType::Dynamic);
-            rb->setFixedRotation(true);
-            rb->initializeBody(scene->getPhysicsWorld());
+            // The shared world keeps the player's body between scenes - only
+            // teleport it. A new body is made the first time (or if the scene
+            // has a world of its own)
+            bool bodyReady = rb->isInitialized() && rb->getWorld() == scene->getPhysicsWorld();
             
             // Get or create Collider for player
             auto* col = m_player->getComponent<engine::Collider2DComponent>();
@@ -254,7 +206,16 @@ void PlayState::onRoomChange(const std::string& roomId) {
                 col = m_player->addComponent<engine::Collider2DComponent>();
                 col->setCapsuleShape(24, 48); // Player hitbox
             }
-            col->initializeShape();
+            
+            if (bodyReady) {
+                rb->setPosition({m_player->getPosition().x, m_player->getPosition().y});
+                rb->setVelocity({0.0f, 0.0f});
+            } else {
+                rb->setBodyType(engine::RigidBody2DComponent::BodyType::Dynamic);
+                rb->setFixedRotation(true);
+                rb->initializeBody(scene->getPhysicsWorld());
+                col->initializeShape();
+            }
             
             // Get or create CharacterController2D
             auto* controller = m_player->getComponent<engine::CharacterController2D>();
@@ -279,11 +240,6 @@ void PlayState::update(float deltaTime) {
     engine::Scene* scene = SceneManager::instance().getCurrentScene();
     if (!scene) return;
     
-    // Step physics simulation
-    if (scene->hasPhysics()) {
-        scene->getPhysicsWorld()->step(deltaTime);
-    }
-    
     // ═══════════════════════════════════════════════════════════════
     // INPUT - Use CharacterController2D if Platformer mode
     // ═══════════════════════════════════════════════════════════════
@@ -308,15 +264,9 @@ void PlayState::update(float deltaTime) {
             controller->releaseJump();
         }
         
-        // Update controller (handles physics)
+        // Registers the controller with the physics world; movement is
+        // applied per fixed step inside step() below
         controller->update(deltaTime);
-        
-        // Manually set grounded based on simple check (temporary)
-        auto* rb = m_player->getComponent<engine::RigidBody2DComponent>();
-        if (rb) {
-            glm::vec2 vel = rb->getVelocity();
-            controller->setGrounded(std::abs(vel.y) < 5.0f);
-        }
     } else {
         // Legacy movement (point-and-click style)
         int dx = 0, dy = 0;
@@ -328,6 +278,18 @@ void PlayState::update(float deltaTime) {
         m_player->moveWithInput(dx, dy, deltaTime);
     }
     
+    // Step physics simulation (fixed timestep, input above is already latched)
+    if (scene->hasPhysics()) {
+        scene->getPhysicsWorld()->step(deltaTime);
+        
+        // Manually set grounded based on simple check (temporary)
+        auto* rb = m_player->getComponent<engine::RigidBody2DComponent>();
+        if (controller && rb && m_playerPhysicsInitialized) {
+            glm::vec2 vel = rb->getVelocity();
+            controller->setGrounded(std::abs(vel.y) < 5.0f);
+        }
+    }
+    
     // Kolla hotspot under musen
     int mx = m_input->getMouseX();
     int my = m_input->getMouseY();